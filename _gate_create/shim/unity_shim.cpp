@@ -0,0 +1,3 @@
+#include "unity.h"
+int unity_failures = 0, unity_tests = 0;
+jmp_buf unity_jmp;
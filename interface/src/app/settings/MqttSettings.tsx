@@ -116,6 +116,15 @@ const MqttSettings = () => {
     [LL]
   );
 
+  const publishRateFields = useMemo(
+    () => [
+      { name: 'publish_flush', label: LL.MQTT_FLUSH(), unit: 'ms' },
+      { name: 'publish_rate_msgs', label: LL.MQTT_RATE_MSGS(), unit: '/s' },
+      { name: 'publish_rate_bytes', label: LL.BYTES(), unit: '/s' }
+    ],
+    [LL]
+  );
+
   if (!data) {
     return (
       <SectionContent>
@@ -455,6 +464,34 @@ const MqttSettings = () => {
             </Grid>
           ))}
         </Grid>
+        <Typography sx={{ pt: 2 }} variant="h6" color="primary">
+          {LL.MQTT_PUBLISH_RATE()}&nbsp;(0=unlimited)
+        </Typography>
+        <Grid container spacing={2} rowSpacing={0}>
+          {publishRateFields.map((field) => (
+            <Grid key={field.name}>
+              <ValidatedTextField
+                fieldErrors={fieldErrors ?? emptyFieldErrors}
+                name={field.name}
+                label={field.label}
+                slotProps={{
+                  input: {
+                    endAdornment: (
+                      <InputAdornment position="end">{field.unit}</InputAdornment>
+                    )
+                  }
+                }}
+                variant="outlined"
+                value={numberValue(
+                  data[field.name as keyof MqttSettingsType] as number
+                )}
+                type="number"
+                onChange={updateFormValue}
+                margin="normal"
+              />
+            </Grid>
+          ))}
+        </Grid>
         {dirtyFlags && dirtyFlags.length !== 0 && (
           <ButtonRow>
             <Button
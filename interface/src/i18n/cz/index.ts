@@ -225,6 +225,9 @@ const cz: Translation = {
   MQTT_INT_SOLAR: 'Solární moduly',
   MQTT_INT_MIXER: 'Směšovací moduly',
   MQTT_INT_WATER: 'Vodní moduly',
+  MQTT_PUBLISH_RATE: 'Rychlost publikování',
+  MQTT_FLUSH: 'Zpoždění odeslání',
+  MQTT_RATE_MSGS: 'Zprávy',
   MQTT_QUEUE: 'MQTT fronta',
   DEFAULT: 'Výchozí',
   MQTT_ENTITY_FORMAT: 'Formát ID entity',
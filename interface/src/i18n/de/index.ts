@@ -225,6 +225,9 @@ const de: Translation = {
   MQTT_INT_SOLAR: 'Solarmodule',
   MQTT_INT_MIXER: 'Mischermodule',
   MQTT_INT_WATER: 'Warmwassermodule',
+  MQTT_PUBLISH_RATE: 'Veröffentlichungsrate',
+  MQTT_FLUSH: 'Sendeverzögerung',
+  MQTT_RATE_MSGS: 'Nachrichten',
   MQTT_QUEUE: 'MQTT Queue',
   DEFAULT: 'Standard',
   MQTT_ENTITY_FORMAT: 'Entitäts-ID Format',
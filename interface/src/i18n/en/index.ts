@@ -225,6 +225,9 @@ const en: Translation = {
   MQTT_INT_SOLAR: 'Solar Modules',
   MQTT_INT_MIXER: 'Mixer Modules',
   MQTT_INT_WATER: 'Water Modules',
+  MQTT_PUBLISH_RATE: 'Publish Rate',
+  MQTT_FLUSH: 'Flush Delay',
+  MQTT_RATE_MSGS: 'Messages',
   MQTT_QUEUE: 'MQTT Queue',
   DEFAULT: 'Default',
   MQTT_ENTITY_FORMAT: 'Entity ID format',
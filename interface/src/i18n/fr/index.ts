@@ -225,6 +225,9 @@ const fr: Translation = {
   MQTT_INT_SOLAR: 'Modules solaires',
   MQTT_INT_MIXER: 'Modules mélangeurs',
   MQTT_INT_WATER: 'Modules eau',
+  MQTT_PUBLISH_RATE: 'Débit de publication',
+  MQTT_FLUSH: "Délai d'envoi",
+  MQTT_RATE_MSGS: 'Messages',
   MQTT_QUEUE: 'Queue MQTT',
   DEFAULT: 'Défaut',
   MQTT_ENTITY_FORMAT: 'Format de l\'ID de l\'entité',
@@ -225,6 +225,9 @@ const it: Translation = {
   MQTT_INT_SOLAR: 'Moduli solari',
   MQTT_INT_MIXER: 'Moduli Mixer',
   MQTT_INT_WATER: 'Moduli Acqua',
+  MQTT_PUBLISH_RATE: 'Frequenza di pubblicazione',
+  MQTT_FLUSH: 'Ritardo di invio',
+  MQTT_RATE_MSGS: 'Messaggi',
   MQTT_QUEUE: 'Coda MQTT',
   DEFAULT: 'Predefinito',
   MQTT_ENTITY_FORMAT: 'Formato ID entità',
@@ -225,6 +225,9 @@ const nl: Translation = {
   MQTT_INT_SOLAR: 'Solar Modules',
   MQTT_INT_MIXER: 'Mixer Modules',
   MQTT_INT_WATER: 'Water Modules',
+  MQTT_PUBLISH_RATE: 'Publicatie snelheid',
+  MQTT_FLUSH: 'Verzendvertraging',
+  MQTT_RATE_MSGS: 'Berichten',
   MQTT_QUEUE: 'MQTT Queue',
   DEFAULT: 'Standaard',
   MQTT_ENTITY_FORMAT: 'Entity ID formaat',
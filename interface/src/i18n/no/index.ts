@@ -225,6 +225,9 @@ const no: Translation = {
   MQTT_INT_SOLAR: 'Solpaneler',
   MQTT_INT_MIXER: 'Blandeventil',
   MQTT_INT_WATER: 'Vannmoduler',
+  MQTT_PUBLISH_RATE: 'Publiseringsrate',
+  MQTT_FLUSH: 'Sendeforsinkelse',
+  MQTT_RATE_MSGS: 'Meldinger',
   MQTT_QUEUE: 'MQTT Queue',
   DEFAULT: 'Standard',
   MQTT_ENTITY_FORMAT: 'Enhets ID format',
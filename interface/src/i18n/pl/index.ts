@@ -225,6 +225,9 @@ const pl: BaseTranslation = {
   MQTT_INT_SOLAR: 'Panele solarne',
   MQTT_INT_MIXER: 'Mieszacze',
   MQTT_INT_WATER: 'Woda',
+  MQTT_PUBLISH_RATE: 'Szybkość publikowania',
+  MQTT_FLUSH: 'Opóźnienie wysyłania',
+  MQTT_RATE_MSGS: 'Wiadomości',
   MQTT_QUEUE: 'Kolejka MQTT',
   DEFAULT: '{{Pozostałe|Domyślna|}}',
   MQTT_ENTITY_FORMAT: 'Format "Entity ID"',
@@ -225,6 +225,9 @@ const sk: Translation = {
   MQTT_INT_SOLAR: 'Solárne moduly',
   MQTT_INT_MIXER: 'Zmiešavacie moduly',
   MQTT_INT_WATER: 'Voda moduly',
+  MQTT_PUBLISH_RATE: 'Rýchlosť zverejňovania',
+  MQTT_FLUSH: 'Oneskorenie odoslania',
+  MQTT_RATE_MSGS: 'Správy',
   MQTT_QUEUE: 'Fronta MQTT',
   DEFAULT: 'Predvolené',
   MQTT_ENTITY_FORMAT: 'ID formát entity',
@@ -225,6 +225,9 @@ const sv: Translation = {
   MQTT_INT_SOLAR: 'Solpaneler',
   MQTT_INT_MIXER: 'Blandningsventiler',
   MQTT_INT_WATER: 'Varmvattenmoduler',
+  MQTT_PUBLISH_RATE: 'Publiceringshastighet',
+  MQTT_FLUSH: 'Sändfördröjning',
+  MQTT_RATE_MSGS: 'Meddelanden',
   MQTT_QUEUE: 'MQTT-kö',
   DEFAULT: 'Standard',
   MQTT_ENTITY_FORMAT: 'Entitets-ID format',
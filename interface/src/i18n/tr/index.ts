@@ -225,6 +225,9 @@ const tr: Translation = {
   MQTT_INT_SOLAR: 'Güneş Enerjisi Modülleri',
   MQTT_INT_MIXER: 'Karışım Modülleri',
   MQTT_INT_WATER: 'Su Modülleri',
+  MQTT_PUBLISH_RATE: 'Yayınlama hızı',
+  MQTT_FLUSH: 'Gönderme gecikmesi',
+  MQTT_RATE_MSGS: 'Mesajlar',
   MQTT_QUEUE: 'MQTT Sırası',
   DEFAULT: 'Varsayılan',
   MQTT_ENTITY_FORMAT: 'Varlık Kimlik biçimi',
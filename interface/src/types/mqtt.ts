@@ -40,6 +40,9 @@ export interface MqttSettingsType {
   publish_time_other: number;
   publish_time_sensor: number;
   publish_time_heartbeat: number;
+  publish_flush: number;
+  publish_rate_msgs: number;
+  publish_rate_bytes: number;
   mqtt_qos: number;
   mqtt_retain: boolean;
   ha_enabled: boolean;
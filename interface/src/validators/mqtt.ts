@@ -10,6 +10,12 @@ const KEEP_ALIVE_MIN = 1;
 const KEEP_ALIVE_MAX = 86400;
 const HEARTBEAT_MIN = 10;
 const HEARTBEAT_MAX = 86400;
+const PUBLISH_FLUSH_MIN = 0;
+const PUBLISH_FLUSH_MAX = 1000;
+const PUBLISH_RATE_MSGS_MIN = 0;
+const PUBLISH_RATE_MSGS_MAX = 1000;
+const PUBLISH_RATE_BYTES_MIN = 0;
+const PUBLISH_RATE_BYTES_MAX = 65535;
 
 // Reusable validator rules
 const REQUIRED_HOST_VALIDATOR = [
@@ -54,6 +60,21 @@ export const createMqttSettingsValidator = (mqttSettings: MqttSettingsType) =>
         'Heartbeat',
         HEARTBEAT_MIN,
         HEARTBEAT_MAX
+      ),
+      publish_flush: createNumberValidator(
+        'Flush',
+        PUBLISH_FLUSH_MIN,
+        PUBLISH_FLUSH_MAX
+      ),
+      publish_rate_msgs: createNumberValidator(
+        'Messages',
+        PUBLISH_RATE_MSGS_MIN,
+        PUBLISH_RATE_MSGS_MAX
+      ),
+      publish_rate_bytes: createNumberValidator(
+        'Bytes',
+        PUBLISH_RATE_BYTES_MIN,
+        PUBLISH_RATE_BYTES_MAX
       )
     })
   });
@@ -187,6 +187,27 @@ uint16_t MqttClient::publish(const char* topic, uint8_t qos, bool retain, espMqt
   return packetId;
 }
 
+uint16_t MqttClient::publish(const char* topic, uint8_t qos, bool retain, size_t length, espMqttClientTypes::PayloadWriter writer) {
+  #if !EMC_ALLOW_NOT_CONNECTED_PUBLISH
+  if (_state != State::connected) {
+  #else
+  if (_state > State::connected) {
+  #endif
+    return 0;
+  }
+  EMC_SEMAPHORE_TAKE();
+  uint16_t packetId = (qos > 0) ? _getNextPacketId() : 1;
+  if (!_addPacket(packetId, topic, length, writer, qos, retain)) {
+    emc_log_e("Could not create PUBLISH packet");
+    EMC_SEMAPHORE_GIVE();
+    _onError(packetId, Error::OUT_OF_MEMORY);
+    EMC_SEMAPHORE_TAKE();
+    packetId = 0;
+  }
+  EMC_SEMAPHORE_GIVE();
+  return packetId;
+}
+
 void MqttClient::clearQueue(bool deleteSessionData) {
   EMC_SEMAPHORE_TAKE();
   _clearQueue(deleteSessionData ? 2 : 0);
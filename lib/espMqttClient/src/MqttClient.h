@@ -65,6 +65,8 @@ class MqttClient {
   uint16_t publish(const char* topic, uint8_t qos, bool retain, const uint8_t* payload, size_t length);
   uint16_t publish(const char* topic, uint8_t qos, bool retain, const char* payload);
   uint16_t publish(const char* topic, uint8_t qos, bool retain, espMqttClientTypes::PayloadCallback callback, size_t length);
+  // writer fills the payload of exactly length bytes in place, in the packet buffer
+  uint16_t publish(const char* topic, uint8_t qos, bool retain, size_t length, espMqttClientTypes::PayloadWriter writer);
   void clearQueue(bool deleteSessionData = false);  // Not MQTT compliant and may cause unpredictable results when `deleteSessionData` = true!
   const char* getClientId() const;
   size_t queueSize();  // No const because of mutex
@@ -81,6 +81,13 @@ class Packet {
          size_t payloadLength,
          uint8_t qos,
          bool retain);
+  Packet(espMqttClientTypes::Error& error,  // NOLINT(runtime/references)
+         uint16_t packetId,
+         const char* topic,
+         size_t payloadLength,
+         espMqttClientTypes::PayloadWriter payloadWriter,
+         uint8_t qos,
+         bool retain);
   // SUBSCRIBE
   Packet(espMqttClientTypes::Error& error,  // NOLINT(runtime/references)
          uint16_t packetId,
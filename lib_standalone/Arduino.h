@@ -98,6 +98,7 @@ int vsnprintf_P(char * str, size_t size, const char * format, va_list ap);
 #include <chrono> // NOLINT [build/c++11]
 #include <thread> // NOLINT [build/c++11] for yield()
 #define millis() std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()
+#define micros() std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()
 // #endif
 
 int64_t esp_timer_get_time();
@@ -56,6 +56,9 @@ class DummySettings {
     uint16_t publish_time_other      = 10;
     uint16_t publish_time_sensor     = 10;
     uint16_t publish_time_heartbeat  = 60;
+    uint16_t publish_flush           = 100;
+    uint16_t publish_rate_msgs       = 100;
+    uint16_t publish_rate_bytes      = 50000;
     uint32_t publish_time_water      = 0;
 
     String  hostname       = "ems-esp";
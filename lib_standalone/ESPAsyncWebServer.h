@@ -5,6 +5,7 @@
 #include "AsyncTCP.h"
 
 #include <functional>
+#include <memory>
 #include <ArduinoJson.h>
 
 class AsyncWebServer;
@@ -13,6 +14,9 @@ class AsyncWebServerResponse;
 class AsyncJsonResponse;
 class AsyncEventSource;
 
+typedef std::function<size_t(uint8_t * buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::weak_ptr<AsyncWebServerRequest>                                  AsyncWebServerRequestPtr;
+
 class AsyncWebParameter {
   private:
     String _name;
@@ -71,6 +75,8 @@ class AsyncWebServerRequest {
 
     String _url;
 
+    std::shared_ptr<AsyncWebServerRequest> _this{this, [](AsyncWebServerRequest *) {}};
+
   public:
     void * _tempObject;
 
@@ -96,6 +102,10 @@ class AsyncWebServerRequest {
         return 0;
     }
 
+    AsyncWebServerRequestPtr pause() {
+        return _this;
+    }
+
     void send(AsyncWebServerResponse * response) {};
 
     void send(AsyncJsonResponse * response) {};
@@ -155,6 +165,10 @@ class AsyncWebServerRequest {
         return nullptr;
     }
 
+    AsyncWebServerResponse * beginResponse(const String & contentType, size_t len, AwsResponseFiller callback) {
+        return nullptr;
+    }
+
     size_t headers() const; // get header count
     size_t params() const;  // get arguments count
 };
@@ -0,0 +1,79 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef EMSESP_STANDALONE
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "HeapStats.h"
+
+static std::atomic<uint32_t> heap_allocs_{0};
+static std::atomic<uint32_t> heap_frees_{0};
+
+uint32_t heap_alloc_count() {
+    return heap_allocs_.load(std::memory_order_relaxed);
+}
+
+uint32_t heap_free_count() {
+    return heap_frees_.load(std::memory_order_relaxed);
+}
+
+static void * heap_alloc(std::size_t size) {
+    heap_allocs_.fetch_add(1, std::memory_order_relaxed);
+    void * p = std::malloc(size ? size : 1);
+    if (p == nullptr) {
+        std::abort(); // built without exceptions, so no std::bad_alloc
+    }
+    return p;
+}
+
+static void heap_free(void * p) {
+    if (p) {
+        heap_frees_.fetch_add(1, std::memory_order_relaxed);
+        std::free(p);
+    }
+}
+
+// replace the global allocation functions
+void * operator new(std::size_t size) {
+    return heap_alloc(size);
+}
+
+void * operator new[](std::size_t size) {
+    return heap_alloc(size);
+}
+
+void operator delete(void * p) noexcept {
+    heap_free(p);
+}
+
+void operator delete[](void * p) noexcept {
+    heap_free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+    heap_free(p);
+}
+
+void operator delete[](void * p, std::size_t) noexcept {
+    heap_free(p);
+}
+
+#endif
@@ -591,6 +591,9 @@ let mqtt_settings = {
   publish_time_other: 10,
   publish_time_sensor: 10,
   publish_time_heartbeat: 60,
+  publish_flush: 100,
+  publish_rate_msgs: 100,
+  publish_rate_bytes: 50000,
   publish_time_water: 60,
   mqtt_qos: 0,
   mqtt_retain: false,
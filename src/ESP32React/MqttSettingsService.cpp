@@ -21,6 +21,12 @@ static String generateClientId() {
 #endif
 }
 
+// a number setting within min and max, otherwise the default
+static uint16_t rangeValue(JsonVariantConst value, const uint16_t min, const uint16_t max, const uint16_t def) {
+    int32_t v = value | static_cast<int32_t>(def);
+    return (v < min || v > max) ? def : static_cast<uint16_t>(v);
+}
+
 MqttSettingsService::~MqttSettingsService() {
     delete _mqttClient;
     _mqttClient = nullptr;
@@ -242,6 +248,9 @@ void MqttSettings::read(MqttSettings & settings, JsonObject root) {
     root["publish_time_other"]      = settings.publish_time_other;
     root["publish_time_sensor"]     = settings.publish_time_sensor;
     root["publish_time_heartbeat"]  = settings.publish_time_heartbeat;
+    root["publish_flush"]           = settings.publish_flush;
+    root["publish_rate_msgs"]       = settings.publish_rate_msgs;
+    root["publish_rate_bytes"]      = settings.publish_rate_bytes;
     root["mqtt_qos"]                = settings.mqtt_qos;
     root["mqtt_retain"]             = settings.mqtt_retain;
     root["ha_enabled"]              = settings.ha_enabled;
@@ -283,6 +292,9 @@ StateUpdateResult MqttSettings::update(JsonObject root, MqttSettings & settings)
     newSettings.publish_time_other      = static_cast<uint16_t>(root["publish_time_other"] | EMSESP_DEFAULT_PUBLISH_TIME_OTHER);
     newSettings.publish_time_sensor     = static_cast<uint16_t>(root["publish_time_sensor"] | EMSESP_DEFAULT_PUBLISH_TIME);
     newSettings.publish_time_heartbeat  = static_cast<uint16_t>(root["publish_time_heartbeat"] | EMSESP_DEFAULT_PUBLISH_HEARTBEAT);
+    newSettings.publish_flush           = rangeValue(root["publish_flush"], 0, 1000, EMSESP_DEFAULT_PUBLISH_FLUSH);
+    newSettings.publish_rate_msgs       = rangeValue(root["publish_rate_msgs"], 0, 1000, EMSESP_DEFAULT_PUBLISH_RATE_MSGS);
+    newSettings.publish_rate_bytes      = rangeValue(root["publish_rate_bytes"], 0, 65535, EMSESP_DEFAULT_PUBLISH_RATE_BYTES);
 
     newSettings.ha_enabled         = root["ha_enabled"] | EMSESP_DEFAULT_HA_ENABLED;
     newSettings.nested_format      = static_cast<uint8_t>(root["nested_format"] | EMSESP_DEFAULT_NESTED_FORMAT);
@@ -383,6 +395,14 @@ StateUpdateResult MqttSettings::update(JsonObject root, MqttSettings & settings)
         emsesp::EMSESP::mqtt_.set_publish_time_heartbeat(newSettings.publish_time_heartbeat);
     }
 
+    if (newSettings.publish_flush != settings.publish_flush) {
+        emsesp::EMSESP::mqtt_.set_publish_flush(newSettings.publish_flush);
+    }
+
+    if (newSettings.publish_rate_msgs != settings.publish_rate_msgs || newSettings.publish_rate_bytes != settings.publish_rate_bytes) {
+        emsesp::EMSESP::mqtt_.set_publish_rate(newSettings.publish_rate_msgs, newSettings.publish_rate_bytes);
+    }
+
 #ifndef TASMOTA_SDK
     // strip down to certificate only
     newSettings.rootCA.replace("\r", "");
@@ -86,6 +86,9 @@ class MqttSettings {
     uint16_t publish_time_other;
     uint16_t publish_time_sensor;
     uint16_t publish_time_heartbeat;
+    uint16_t publish_flush;      // ms between handing the pending publishes to the MQTT client
+    uint16_t publish_rate_msgs;  // max publishes per second, 0 is unlimited
+    uint16_t publish_rate_bytes; // max bytes of topic and payload per second, 0 is unlimited
     uint8_t  mqtt_qos;
     bool     mqtt_retain;
     bool     ha_enabled;
@@ -596,7 +596,7 @@ bool AnalogSensor::update(uint8_t gpio, const char * org_name, double offset, do
 
 // check to see if values have been updated
 bool AnalogSensor::updated_values() {
-    if (changed_ && Mqtt::publish_queued() == 0) {
+    if (changed_ && Mqtt::publish_queued(Mqtt::PRIORITY_DEVICE) == 0) {
         changed_ = false;
         return true;
     }
@@ -620,9 +620,11 @@ void AnalogSensor::publish_sensor(const Sensor & sensor) const {
         }
         Mqtt::queue_publish(topic, result); // always publish as doubles
     }
-    char cmd[COMMAND_MAX_LENGTH];
-    snprintf(cmd, sizeof(cmd), "%s/%s", F_(analogsensor), sensor.name());
-    EMSESP::webSchedulerService.onChange(cmd);
+    if (EMSESP::webSchedulerService.watches(EMSdevice::DeviceType::ANALOGSENSOR)) {
+        char cmd[COMMAND_MAX_LENGTH];
+        snprintf(cmd, sizeof(cmd), "%s/%s", F_(analogsensor), sensor.name());
+        EMSESP::webSchedulerService.onChange(cmd);
+    }
 }
 
 // send empty config topic to remove the entry from HA
@@ -0,0 +1,161 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "buscapture.h"
+
+namespace emsesp {
+
+std::atomic<bool>                                          BusCapture::active_{false};
+RingBuffer<RxService::RxFrame, BusCapture::CAPTURE_FRAMES> BusCapture::ring_;
+std::vector<char, AllocatorPSRAM<char>>                    BusCapture::buffer_;
+std::mutex                                                 BusCapture::mutex_;
+size_t                                                     BusCapture::max_size_       = 0;
+uint32_t                                                   BusCapture::frames_         = 0;
+std::atomic<uint32_t>                                      BusCapture::dropped_{0};
+uint32_t                                                   BusCapture::last_timestamp_ = 0;
+
+// start a new capture, the previous one is discarded
+void BusCapture::start() {
+    active_.store(false, std::memory_order_relaxed);
+    while (ring_.front() != nullptr) {
+        ring_.pop();
+    }
+
+    max_size_ = EMSESP::system_.PSram() ? CAPTURE_SIZE : CAPTURE_SIZE_RAM;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer_.clear();
+        buffer_.reserve(max_size_);
+    }
+    frames_         = 0;
+    last_timestamp_ = 0;
+    dropped_.store(0, std::memory_order_relaxed);
+
+    char header[80];
+    snprintf(header, sizeof(header), "# EMS-ESP %s bus capture, bus id 0x%02X, %s\n", EMSESP_APP_VERSION, EMSbus::ems_bus_id(), EMSbus::is_ht3() ? "HT3" : "Buderus");
+    append(header, strlen(header));
+
+    active_.store(true, std::memory_order_release);
+}
+
+// stop recording, the capture is kept until the next start
+void BusCapture::stop() {
+    active_.store(false, std::memory_order_relaxed);
+    loop(); // format what is still in the ring
+}
+
+// stop and free the memory of the capture
+void BusCapture::clear() {
+    stop();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+    }
+    frames_ = 0;
+}
+
+// called from the UART task for every frame, only copies it
+void BusCapture::record(const uint8_t * data, const uint8_t length) {
+    if (!active_.load(std::memory_order_acquire) || length == 0 || length > EMS_MAX_TELEGRAM_LENGTH) {
+        return;
+    }
+
+    RxService::RxFrame * frame = ring_.write_slot();
+    if (frame == nullptr) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    frame->timestamp_ = ::micros();
+    frame->length_    = length;
+    memcpy(frame->data_, data, length);
+    ring_.push();
+}
+
+// format the recorded frames, stops when the buffer is full
+void BusCapture::loop() {
+    const RxService::RxFrame * frame;
+    while ((frame = ring_.front()) != nullptr) {
+        // time, and 3 characters per byte
+        char     line[12 + 3 * EMS_MAX_TELEGRAM_LENGTH];
+        uint32_t delta = frames_ ? frame->timestamp_ - last_timestamp_ : 0;
+        size_t   pos   = snprintf(line, sizeof(line), "%u", (unsigned)delta);
+        for (uint8_t i = 0; i < frame->length_; i++) {
+            line[pos++] = ' ';
+            Helpers::hextoa(&line[pos], frame->data_[i]);
+            pos += 2;
+        }
+        line[pos++] = '\n';
+
+        if (buffer_.size() + pos > max_size_) {
+            active_.store(false, std::memory_order_relaxed);
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            append(line, pos);
+            last_timestamp_ = frame->timestamp_;
+            frames_++;
+        }
+        ring_.pop();
+    }
+}
+
+// the buffer is reserved on start, so appending never moves it
+void BusCapture::append(const char * s, size_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.insert(buffer_.end(), s, s + length);
+}
+
+size_t BusCapture::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.size();
+}
+
+size_t BusCapture::read(uint8_t * data, size_t length, size_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index >= buffer_.size()) {
+        return 0;
+    }
+    length = std::min(length, buffer_.size() - index);
+    memcpy(data, buffer_.data() + index, length);
+    return length;
+}
+
+uint8_t BusCapture::parse(const char * line, uint32_t & delta_us, uint8_t * data) {
+    if (line[0] == '#') {
+        return 0;
+    }
+
+    char * end;
+    delta_us = strtoul(line, &end, 10);
+    if (end == line) {
+        return 0;
+    }
+
+    uint8_t length = 0;
+    while (length < EMS_MAX_TELEGRAM_LENGTH) {
+        const char * p     = end;
+        long         value = strtol(p, &end, 16);
+        if (end == p) {
+            break;
+        }
+        data[length++] = (uint8_t)value;
+    }
+    return length;
+}
+
+} // namespace emsesp
@@ -0,0 +1,81 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMSESP_BUSCAPTURE_H
+#define EMSESP_BUSCAPTURE_H
+
+#include "emsesp.h"
+
+#include <mutex>
+
+namespace emsesp {
+
+// Records everything the UART receives (polls, echoes and telegrams with their CRC) for a replay in standalone.
+// The capture is text, one frame per line: the time in us since the previous frame and the bytes in hex,
+// e.g. "1250 0B 88 02 00 ..." - lines starting with # are comments.
+// The UART task only copies the frame into a ring, the main loop formats it.
+// The web server task reads the text straight from the buffer, so changes to the buffer are locked.
+class BusCapture {
+  public:
+    static constexpr uint8_t  CAPTURE_FRAMES   = 64;     // frames waiting to be formatted, must be a power of 2
+    static constexpr uint32_t CAPTURE_SIZE     = 512000; // bytes of text with PSRAM
+    static constexpr uint32_t CAPTURE_SIZE_RAM = 16000;  // bytes of text without PSRAM
+
+    static void start();
+    static void stop();
+    static void clear();
+    static void loop();
+    static void record(const uint8_t * data, const uint8_t length);
+
+    // reads one line of a capture, returns the frame length or 0 for a comment or an invalid line
+    static uint8_t parse(const char * line, uint32_t & delta_us, uint8_t * data);
+
+    static bool active() {
+        return active_.load(std::memory_order_relaxed);
+    }
+
+    static uint32_t frames() {
+        return frames_;
+    }
+
+    static uint32_t dropped() {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    // bytes of capture text
+    static size_t size();
+
+    // copies up to length bytes of the capture text from index, returns the bytes copied
+    static size_t read(uint8_t * data, size_t length, size_t index);
+
+  private:
+    static void append(const char * s, size_t length);
+
+    static std::atomic<bool>                              active_;
+    static RingBuffer<RxService::RxFrame, CAPTURE_FRAMES> ring_;    // written by the UART task
+    static std::vector<char, AllocatorPSRAM<char>>        buffer_;  // the capture text
+    static std::mutex                                     mutex_;   // for buffer_
+    static size_t                                         max_size_;
+    static uint32_t                                       frames_;  // # frames in the capture
+    static std::atomic<uint32_t>                          dropped_; // # frames lost because the ring or the buffer was full
+    static uint32_t                                       last_timestamp_;
+};
+
+} // namespace emsesp
+
+#endif
@@ -20,11 +20,24 @@
 #include "emsdevice.h"
 #include "emsesp.h"
 
+#ifdef EMSESP_STANDALONE
+#include <thread>
+#endif
+
 namespace emsesp {
 
 uuid::log::Logger Command::logger_{F_(command), uuid::log::Facility::DAEMON};
 
 std::vector<Command::CmdFunction, AllocatorPSRAM<Command::CmdFunction>> Command::cmdfunctions_;
+std::vector<Command::CmdIndex, AllocatorPSRAM<Command::CmdIndex>>       Command::cmdindex_;
+MpscRingBuffer<std::shared_ptr<Command::Request>, COMMAND_QUEUE_SIZE>   Command::queue_;
+
+// the task running EMSESP::loop(), set by start() before the other tasks are created
+#ifndef EMSESP_STANDALONE
+static TaskHandle_t loop_task_ = nullptr;
+#else
+static std::thread::id loop_task_;
+#endif
 
 // takes a URI path and a json body, parses the data and calls the command
 // the path is leading so if duplicate keys are in the input JSON it will be ignored
@@ -205,6 +218,148 @@ uint8_t Command::process(const char * path, const bool is_admin, const JsonObjec
     return return_code;
 }
 
+// fast path for MQTT, a plain value sent to <device>/<cmd> or <device>/<hc>/<cmd>, the path without the base
+// calls the command without building an input json or splitting the path into strings
+// returns false if the path or value doesn't fit, then the caller uses process()
+// like process() it changes devices and the Tx queue, so it's only called in the main loop (Mqtt::on_command)
+bool Command::process_value(const char * path, const char * value, const bool is_admin, JsonObject output, uint8_t & return_code) {
+    // json and values referring to another entity like device/hc/name are left to process()
+    if (*value == '{' || strchr(value, '/') != nullptr) {
+        return false;
+    }
+
+    const char * command_p = strchr(path, '/');
+    if (command_p == nullptr || command_p == path || strpbrk(path, "?=&") != nullptr) {
+        return false;
+    }
+
+    char device_s[20];
+    if ((size_t)(command_p - path) >= sizeof(device_s)) {
+        return false;
+    }
+    strlcpy(device_s, path, command_p - path + 1);
+    uint8_t device_type = EMSdevice::device_name_2_device_type(device_s);
+    if (!device_has_commands(device_type)) {
+        return false;
+    }
+
+    // the command, at most one level of hc/dhw/.. in front, no empty parts
+    command_p++;
+    const char * tag_end = strchr(command_p, '/');
+    if (*command_p == '\0' || strlen(command_p) >= COMMAND_MAX_LENGTH
+        || (tag_end && (tag_end == command_p || tag_end[1] == '\0' || strchr(tag_end + 1, '/')))) {
+        return false;
+    }
+
+    int8_t id_n = -1;
+    if (device_type >= EMSdevice::DeviceType::BOILER) {
+        command_p = parse_command_string(command_p, id_n);
+        if (command_p == nullptr) {
+            return false;
+        }
+    }
+
+    return_code = call(device_type, command_p, value, is_admin, id_n, output);
+    return true;
+}
+
+// called from EMSESP::start(), in the task that runs the main loop
+void Command::start() {
+#ifndef EMSESP_STANDALONE
+    loop_task_ = xTaskGetCurrentTaskHandle();
+#else
+    loop_task_ = std::this_thread::get_id();
+#endif
+}
+
+// is the caller running in the main loop
+bool Command::in_loop() {
+#ifndef EMSESP_STANDALONE
+    return loop_task_ == xTaskGetCurrentTaskHandle();
+#else
+    return loop_task_ == std::this_thread::get_id();
+#endif
+}
+
+std::shared_ptr<Command::Request> Command::queue_request(const char * path, const bool is_admin, const JsonObject input, cmd_done_function_p done) {
+    auto request       = std::make_shared<Command::Request>();
+    request->path_     = path;
+    request->is_admin_ = is_admin;
+    request->done_     = std::move(done);
+    request->input_.to<JsonObject>().set(input);
+    if (!queue_request(request)) {
+        return nullptr;
+    }
+    return request;
+}
+
+bool Command::queue_request(std::shared_ptr<Request> request) {
+    return queue_.push(std::move(request));
+}
+
+// like process(), but called from other tasks (scheduler, modbus) the command is queued
+// and executed by the main loop, so devices and the Tx queue are only changed there
+// waits for the result, gives up if the main loop doesn't pick it up in time
+// the web API doesn't wait, it posts the command and answers when it is done
+uint8_t Command::execute(const char * path, const bool is_admin, const JsonObject input, JsonObject output) {
+    if (in_loop()) {
+        return process(path, is_admin, input, output);
+    }
+
+    auto request = queue_request(path, is_admin, input, nullptr);
+    if (request == nullptr) {
+        return json_message(CommandRet::ERROR, "command queue full", output);
+    }
+
+    for (uint16_t wait = 0; wait < COMMAND_QUEUE_TIMEOUT && request->state_.load(std::memory_order_acquire) != RequestState::DONE; wait++) {
+        delay(1);
+    }
+    uint8_t queued = RequestState::QUEUED;
+    if (request->state_.compare_exchange_strong(queued, RequestState::CANCELLED)) {
+        return json_message(CommandRet::ERROR, "command timed out", output);
+    }
+    while (request->state_.load(std::memory_order_acquire) != RequestState::DONE) {
+        delay(1); // already running
+    }
+
+    output.set(request->output_.as<JsonObjectConst>());
+    return request->return_code_;
+}
+
+// queue a command for the main loop without waiting, done is called there with the result
+bool Command::post(const char * path, const bool is_admin, const JsonObject input, cmd_done_function_p done) {
+    return queue_request(path, is_admin, input, std::move(done)) != nullptr;
+}
+
+// queue any work that changes devices or the Tx queue for the main loop, e.g. incoming MQTT messages
+bool Command::post(cmd_run_function_p run) {
+    auto request  = std::make_shared<Command::Request>();
+    request->run_ = std::move(run);
+    return queue_request(std::move(request));
+}
+
+// called from the main loop, run the queued commands
+void Command::loop() {
+    std::shared_ptr<Request> request;
+    while (queue_.pop(request)) {
+        uint8_t queued = RequestState::QUEUED;
+        if (!request->state_.compare_exchange_strong(queued, RequestState::RUNNING)) {
+            continue; // the caller gave up
+        }
+        if (request->run_) {
+            request->run_();
+            request->state_.store(RequestState::DONE, std::memory_order_release);
+            continue;
+        }
+        JsonObject output     = request->output_.to<JsonObject>();
+        request->return_code_ = process(request->path_.c_str(), request->is_admin_, request->input_.as<JsonObject>(), output);
+        if (request->done_) {
+            request->done_(request->return_code_, output);
+        }
+        request->state_.store(RequestState::DONE, std::memory_order_release);
+    }
+}
+
 const char * Command::return_code_string(const uint8_t return_code) {
     switch (return_code) {
     case CommandRet::ERROR:
@@ -502,6 +657,7 @@ void Command::add(const uint8_t device_type, const uint8_t device_id, const char
     }
 
     cmdfunctions_.emplace_back(device_type, device_id, flags, cmd, cb, nullptr, description); // callback for json is nullptr
+    add_index(cmdfunctions_.size() - 1);
 }
 
 // add a command with no json output
@@ -518,6 +674,44 @@ void Command::add(const uint8_t device_type, const char * cmd, const cmd_json_fu
     }
 
     cmdfunctions_.emplace_back(device_type, 0, flags, cmd, nullptr, cb, description); // callback for json is included
+    add_index(cmdfunctions_.size() - 1);
+}
+
+// the index key is the device type in the low byte and the hash of the lower case command above it
+uint32_t Command::command_key(const uint8_t device_type, const char * cmd) {
+    return (Helpers::hash_lower(cmd) << 8) | device_type;
+}
+
+// add a new command to the index, after all others with the same key
+void Command::add_index(const uint16_t slot) {
+    uint32_t key = command_key(cmdfunctions_[slot].device_type_, cmdfunctions_[slot].cmd_);
+    auto     pos = std::upper_bound(cmdindex_.begin(), cmdindex_.end(), key, [](const uint32_t k, const CmdIndex & c) { return k < c.key_; });
+    cmdindex_.insert(pos, {key, slot});
+}
+
+// erasing shifts the slots, so build the index again
+void Command::rebuild_index() {
+    cmdindex_.clear();
+    cmdindex_.reserve(cmdfunctions_.size());
+    for (uint16_t slot = 0; slot < cmdfunctions_.size(); slot++) {
+        cmdindex_.push_back({command_key(cmdfunctions_[slot].device_type_, cmdfunctions_[slot].cmd_), slot});
+    }
+    std::stable_sort(cmdindex_.begin(), cmdindex_.end(), [](const CmdIndex & a, const CmdIndex & b) { return a.key_ < b.key_; });
+}
+
+// slot of the first command in registration order for this device type and name (not case sensitive) for which match(cf) is true
+// returns -1 if not found
+template <typename F>
+int Command::find_command_slot(const uint8_t device_type, const char * cmd, F match) {
+    uint32_t key = command_key(device_type, cmd);
+    auto     it  = std::lower_bound(cmdindex_.begin(), cmdindex_.end(), key, [](const CmdIndex & c, const uint32_t k) { return c.key_ < k; });
+    for (; it != cmdindex_.end() && it->key_ == key; ++it) {
+        const auto & cf = cmdfunctions_[it->slot_];
+        if ((cf.device_type_ == device_type) && strcasecmp(cmd, cf.cmd_) == 0 && match(cf)) {
+            return it->slot_;
+        }
+    }
+    return -1;
 }
 
 // see if a command exists for that device type
@@ -527,40 +721,34 @@ Command::CmdFunction * Command::find_command(const uint8_t device_type, const ui
         return nullptr;
     }
 
-    for (auto & cf : cmdfunctions_) {
-        if (Helpers::toLower(cmd) == Helpers::toLower(cf.cmd_) && (cf.device_type_ == device_type) && (!device_id || cf.device_id_ == device_id)
-            && (cf.device_type_ < EMSdevice::DeviceType::BOILER || flag == CommandFlag::CMD_FLAG_DEFAULT || (flag & 0x3F) == (cf.flags_ & 0x3F))) {
-            return &cf;
-        }
+    int slot = find_command_slot(device_type, cmd, [&](const CmdFunction & cf) {
+        return (!device_id || cf.device_id_ == device_id)
+               && (cf.device_type_ < EMSdevice::DeviceType::BOILER || flag == CommandFlag::CMD_FLAG_DEFAULT || (flag & 0x3F) == (cf.flags_ & 0x3F));
+    });
+    if (slot < 0) {
+        return nullptr; // command not found, could be an attribute?
     }
 
-    return nullptr; // command not found, could be an attribute?
+    return &cmdfunctions_[slot];
 }
 
 void Command::erase_device_commands(const uint8_t device_type) {
     if (cmdfunctions_.empty()) {
         return;
     }
-    auto it = cmdfunctions_.end();
-    do {
-        int i = it - cmdfunctions_.begin();
-        if (cmdfunctions_[i].device_type_ == device_type) {
-            cmdfunctions_.erase(it);
-        }
-    } while (it-- > cmdfunctions_.begin());
+    cmdfunctions_.erase(std::remove_if(cmdfunctions_.begin(), cmdfunctions_.end(), [&](const CmdFunction & cf) { return cf.device_type_ == device_type; }),
+                        cmdfunctions_.end());
+    rebuild_index();
 }
 
 void Command::erase_command(const uint8_t device_type, const char * cmd, uint8_t flag) {
     if ((cmd == nullptr) || (strlen(cmd) == 0) || (cmdfunctions_.empty())) {
         return;
     }
-    auto it = cmdfunctions_.begin();
-    for (auto const & cf : cmdfunctions_) {
-        if (Helpers::toLower(cmd) == Helpers::toLower(cf.cmd_) && (cf.device_type_ == device_type) && ((flag & 0x3F) == (cf.flags_ & 0x3F))) {
-            cmdfunctions_.erase(it);
-            return;
-        }
-        it++;
+    int slot = find_command_slot(device_type, cmd, [&](const CmdFunction & cf) { return (flag & 0x3F) == (cf.flags_ & 0x3F); });
+    if (slot >= 0) {
+        cmdfunctions_.erase(cmdfunctions_.begin() + slot);
+        rebuild_index();
     }
 }
 
@@ -19,9 +19,12 @@
 #ifndef EMSESP_COMMAND_H_
 #define EMSESP_COMMAND_H_
 
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 
 #include "console.h"
+#include "ringbuffer.h"
 #include <esp32-psram.h>
 
 using uuid::console::Shell;
@@ -29,6 +32,8 @@ using uuid::console::Shell;
 namespace emsesp {
 
 #define COMMAND_MAX_LENGTH 50
+#define COMMAND_QUEUE_SIZE 16      // commands from other tasks waiting for the main loop
+#define COMMAND_QUEUE_TIMEOUT 2000 // ms to wait for the main loop to pick up a command
 
 // mqtt flags for command subscriptions
 enum CommandFlag : uint8_t {
@@ -56,6 +61,8 @@ enum CommandRet : uint8_t {
 
 using cmd_function_p      = std::function<bool(const char * data, const int8_t id)>;
 using cmd_json_function_p = std::function<bool(const char * data, const int8_t id, JsonObject output)>;
+using cmd_done_function_p = std::function<void(const uint8_t return_code, JsonObject output)>;
+using cmd_run_function_p  = std::function<void()>;
 
 class Command {
   public:
@@ -98,7 +105,7 @@ class Command {
         }
     };
 
-    static std::vector<CmdFunction, AllocatorPSRAM<CmdFunction>> commands() {
+    static const std::vector<CmdFunction, AllocatorPSRAM<CmdFunction>> & commands() {
         return cmdfunctions_;
     }
 
@@ -136,6 +143,15 @@ class Command {
     static bool list(const uint8_t device_type, JsonObject output);
 
     static uint8_t process(const char * path, const bool is_admin, const JsonObject input, JsonObject output);
+    static bool    process_value(const char * path, const char * value, const bool is_admin, JsonObject output, uint8_t & return_code);
+
+    // process() from any task, the command runs in the main loop
+    static uint8_t execute(const char * path, const bool is_admin, const JsonObject input, JsonObject output);
+    static bool    post(const char * path, const bool is_admin, const JsonObject input, cmd_done_function_p done = nullptr);
+    static bool    post(cmd_run_function_p run);
+    static void    start();
+    static void    loop();
+    static bool    in_loop();
 
     static const char * parse_command_string(const char * command, int8_t & id);
     static const char * get_attribute(const char * cmd);
@@ -148,6 +164,35 @@ class Command {
 
     static std::vector<CmdFunction, AllocatorPSRAM<CmdFunction>> cmdfunctions_; // the list of commands
 
+    // entry in the command index, see find_command()
+    struct CmdIndex {
+        uint32_t key_;  // see command_key()
+        uint16_t slot_; // index in cmdfunctions_
+    };
+    static std::vector<CmdIndex, AllocatorPSRAM<CmdIndex>> cmdindex_; // sorted by key, equal keys in registration order
+
+    // a command posted by another task, shared until both the poster and the main loop are done with it
+    enum RequestState : uint8_t { QUEUED, RUNNING, DONE, CANCELLED };
+    struct Request {
+        std::string          path_;
+        bool                 is_admin_;
+        JsonDocument         input_;
+        JsonDocument         output_;
+        uint8_t              return_code_ = CommandRet::FAIL;
+        cmd_done_function_p  done_; // called in the main loop with the result
+        cmd_run_function_p   run_;  // if set, called in the main loop instead of the command
+        std::atomic<uint8_t> state_{RequestState::QUEUED};
+    };
+    static MpscRingBuffer<std::shared_ptr<Request>, COMMAND_QUEUE_SIZE> queue_;
+    static std::shared_ptr<Request> queue_request(const char * path, const bool is_admin, const JsonObject input, cmd_done_function_p done);
+    static bool                     queue_request(std::shared_ptr<Request> request);
+
+    static uint32_t command_key(const uint8_t device_type, const char * cmd);
+    static void     add_index(const uint16_t slot);
+    static void     rebuild_index();
+    template <typename F>
+    static int find_command_slot(const uint8_t device_type, const char * cmd, F match);
+
     static uint8_t json_message(uint8_t error_code, const char * message, JsonObject output, const char * object = nullptr);
 };
 
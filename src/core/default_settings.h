@@ -202,6 +202,20 @@
 #define EMSESP_DEFAULT_PUBLISH_HEARTBEAT 60
 #endif
 
+// in milliseconds
+#ifndef EMSESP_DEFAULT_PUBLISH_FLUSH
+#define EMSESP_DEFAULT_PUBLISH_FLUSH 100
+#endif
+
+// per second, 0 is unlimited
+#ifndef EMSESP_DEFAULT_PUBLISH_RATE_MSGS
+#define EMSESP_DEFAULT_PUBLISH_RATE_MSGS 100
+#endif
+
+#ifndef EMSESP_DEFAULT_PUBLISH_RATE_BYTES
+#define EMSESP_DEFAULT_PUBLISH_RATE_BYTES 50000
+#endif
+
 #ifndef EMSESP_DEFAULT_NESTED_FORMAT
 #define EMSESP_DEFAULT_NESTED_FORMAT 1
 #endif
@@ -340,7 +340,9 @@ std::string EMSdevice::to_string_short() {
 }
 
 // for each telegram that has the fetch value set (true) do a read request
-void EMSdevice::fetch_values() {
+// the scheduled fetch skips telegrams seen on the bus since the last cycle, and those which
+// didn't change for a while are fetched less often, see handle_telegram()
+void EMSdevice::fetch_values(const bool scheduled) {
     if (!active_) {
         return;
     }
@@ -348,10 +350,20 @@ void EMSdevice::fetch_values() {
     EMSESP::logger().debug("Fetching values for deviceID 0x%02X", device_id());
 #endif
 
-    for (const auto & tf : telegram_functions_) {
-        if (tf.fetch_) {
-            read_command(tf.telegram_type_id_);
+    for (auto & tf : telegram_functions_) {
+        if (!tf.fetch_) {
+            continue;
+        }
+        if (scheduled && tf.received_) {
+            if (tf.broadcast_time_ && uuid::get_uptime() - tf.broadcast_time_ < EMSESP::EMS_FETCH_FREQUENCY) {
+                continue;
+            }
+            if (++tf.fetch_skipped_ < (1 << tf.fetch_backoff_)) {
+                continue;
+            }
         }
+        tf.fetch_skipped_ = 0;
+        read_command(tf.telegram_type_id_);
     }
 }
 
@@ -390,22 +402,34 @@ bool EMSdevice::is_received(uint16_t telegram_id) const {
 
 // check for a tag to create a nest
 bool EMSdevice::has_tags(const int8_t tag) const {
-    for (const auto & dv : devicevalues_) {
-        if (dv.tag == tag && tag >= DeviceValueTAG::TAG_HC1) {
-            return true;
+    if (tag < DeviceValueTAG::TAG_HC1) {
+        return false;
+    }
+    auto range = find_tag_range(tag);
+    return range.first != range.second;
+}
+
+// slot of the first value in registration order with this short name (ignoring case) for which match(dv) is true
+// returns -1 if not found
+template <typename F>
+int EMSdevice::find_short_name(const char * name, F match) const {
+    uint32_t hash = Helpers::hash_lower(name);
+    auto     it   = std::lower_bound(name_index_.begin(), name_index_.end(), hash, [](const ShortNameIndex & n, const uint32_t h) { return n.hash_ < h; });
+    for (; it != name_index_.end() && it->hash_ == hash; ++it) {
+        const auto & dv = devicevalues_[it->slot_];
+        if (strcasecmp(dv.short_name, name) == 0 && match(dv)) {
+            return it->slot_;
         }
     }
-    return false;
+    return -1;
 }
 
 // check if the device has a command with this tag.
 bool EMSdevice::has_cmd(const char * cmd, const int8_t id) const {
-    for (const auto & dv : devicevalues_) {
-        if ((id < 1 || dv.tag == id) && dv.has_cmd && strcmp(dv.short_name, cmd) == 0 && (dv.hasValue() || dv.type == DeviceValueType::CMD)) {
-            return true;
-        }
-    }
-    return false;
+    int slot = find_short_name(cmd, [&](const DeviceValue & dv) {
+        return (id < 1 || dv.tag == id) && dv.has_cmd && strcmp(dv.short_name, cmd) == 0 && (dv.hasValue() || dv.type == DeviceValueType::CMD);
+    });
+    return slot >= 0;
 }
 
 // list of registered device entries
@@ -531,6 +555,7 @@ void EMSdevice::show_mqtt_handlers(uuid::console::Shell & shell) const {
 // register a callback function for a specific telegram type
 void EMSdevice::register_telegram_type(const uint16_t telegram_type_id, const char * telegram_type_name, bool fetch, const process_function_p f) {
     telegram_functions_.emplace_back(telegram_type_id, telegram_type_name, fetch, false, f);
+    EMSESP::telegram_dispatch_changed(); // rebuild the dispatch index before the next telegram
 }
 
 // add to device value library, also know now as a "device entity"
@@ -632,6 +657,22 @@ void EMSdevice::add_device_value(int8_t                tag,              // to b
     devicevalues_.emplace_back(
         device_type_, tag, value_p, type, options, options_single, numeric_operator, short_name, fullname, custom_fullname, uom, has_cmd, min, max, state);
 
+    // keep the value pointer index sorted, slots sharing a pointer stay in registration order
+    auto pos = std::upper_bound(value_index_.begin(), value_index_.end(), value_p, [&](const void * p, const uint16_t slot) {
+        return std::less<const void *>()(p, devicevalues_[slot].value_p);
+    });
+    value_index_.insert(pos, devicevalues_.size() - 1);
+
+    // and the tag index, slots within a tag stay in registration order
+    auto tag_pos = std::upper_bound(tag_index_.begin(), tag_index_.end(), tag, [&](const int8_t t, const uint16_t slot) { return t < devicevalues_[slot].tag; });
+    tag_index_.insert(tag_pos, devicevalues_.size() - 1);
+
+    // and the short name index, for the same hash also in registration order
+    uint32_t hash     = Helpers::hash_lower(short_name);
+    auto     name_pos = std::upper_bound(name_index_.begin(), name_index_.end(), hash, [](const uint32_t h, const ShortNameIndex & n) { return h < n.hash_; });
+    name_index_.insert(name_pos, {hash, (uint16_t)(devicevalues_.size() - 1)});
+    EMSESP::entity_bindings_changed();
+
     // add a new command if it has a function attached
     if (has_cmd) {
         uint8_t flags = CommandFlag::ADMIN_ONLY; // executing commands require admin privileges
@@ -762,13 +803,14 @@ bool EMSdevice::is_readable(const void * value_p) const {
 // check if value/command is readonly
 // matches valid tags too
 bool EMSdevice::is_readonly(const std::string & cmd, const int8_t id) const {
-    for (const auto & dv : devicevalues_) {
-        // check command name and tag, id -1 is default hc and only checks name
-        if (dv.has_cmd && std::string(dv.short_name) == cmd && (dv.tag < DeviceValueTAG::TAG_HC1 || dv.tag == id || id == -1)) {
-            return dv.has_state(DeviceValueState::DV_READONLY);
-        }
+    // check command name and tag, id -1 is default hc and only checks name
+    int slot = find_short_name(cmd.c_str(), [&](const DeviceValue & dv) {
+        return dv.has_cmd && cmd == dv.short_name && (dv.tag < DeviceValueTAG::TAG_HC1 || dv.tag == id || id == -1);
+    });
+    if (slot < 0) {
+        return true; // not found, no write
     }
-    return true; // not found, no write
+    return devicevalues_[slot].has_state(DeviceValueState::DV_READONLY);
 }
 
 // check if value has a registered command
@@ -793,6 +835,20 @@ void EMSdevice::set_minmax(const void * value_p, int16_t min, uint32_t max) {
     }
 }
 
+// first entry in value_index_ for this value pointer, or the position where it would be
+std::vector<uint16_t, AllocatorPSRAM<uint16_t>>::const_iterator EMSdevice::find_value_index(const void * value_p) const {
+    return std::lower_bound(value_index_.begin(), value_index_.end(), value_p, [&](const uint16_t slot, const void * p) {
+        return std::less<const void *>()(devicevalues_[slot].value_p, p);
+    });
+}
+
+// the range of slots in tag_index_ holding values with this tag
+std::pair<const uint16_t *, const uint16_t *> EMSdevice::find_tag_range(const int8_t tag) const {
+    auto first = std::lower_bound(tag_index_.begin(), tag_index_.end(), tag, [&](const uint16_t slot, const int8_t t) { return devicevalues_[slot].tag < t; });
+    auto last  = std::upper_bound(first, tag_index_.end(), tag, [&](const int8_t t, const uint16_t slot) { return t < devicevalues_[slot].tag; });
+    return {tag_index_.data() + (first - tag_index_.begin()), tag_index_.data() + (last - tag_index_.begin())};
+}
+
 // publish a single value on change
 void EMSdevice::publish_value(void * value_p) const {
     // if (!Mqtt::publish_single() || value_p == nullptr) {
@@ -800,8 +856,10 @@ void EMSdevice::publish_value(void * value_p) const {
         return;
     }
 
-    for (const auto & dv : devicevalues_) {
-        if (dv.value_p == value_p && !dv.has_state(DeviceValueState::DV_API_MQTT_EXCLUDE)) {
+    // a value pointer can be registered more than once, so walk all slots holding it
+    for (auto it = find_value_index(value_p); it != value_index_.end() && devicevalues_[*it].value_p == value_p; ++it) {
+        const auto & dv = devicevalues_[*it];
+        if (!dv.has_state(DeviceValueState::DV_API_MQTT_EXCLUDE)) {
             char topic[Mqtt::MQTT_TOPIC_MAX_SIZE];
             if (Mqtt::publish_single2cmd()) {
                 if (dv.tag >= DeviceValueTAG::TAG_HC1) {
@@ -868,30 +926,39 @@ void EMSdevice::publish_value(void * value_p) const {
                 Mqtt::queue_publish(topic, payload);
             }
             // check scheduler for on change
-            char cmd[COMMAND_MAX_LENGTH];
-            if (dv.tag >= DeviceValueTAG::TAG_HC1) {
-                snprintf(cmd, sizeof(cmd), "%s/%s/%s", device_type_2_device_name(device_type_), tag_to_mqtt(dv.tag), dv.short_name);
-            } else {
-                snprintf(cmd, sizeof(cmd), "%s/%s", device_type_2_device_name(device_type_), (dv.short_name));
+            if (EMSESP::webSchedulerService.watches(device_type_)) {
+                char cmd[COMMAND_MAX_LENGTH];
+                EMSESP::webSchedulerService.onChange(value_cmd(cmd, sizeof(cmd), dv));
             }
-            EMSESP::webSchedulerService.onChange(cmd);
         }
     }
 }
 
+// the entity as the scheduler sees it, like "thermostat/hc1/seltemp" or "boiler/flowtempoffset"
+char * EMSdevice::value_cmd(char * cmd, const size_t len, const DeviceValue & dv) const {
+    if (dv.tag >= DeviceValueTAG::TAG_HC1) {
+        snprintf(cmd, len, "%s/%s/%s", device_type_2_device_name(device_type_), tag_to_mqtt(dv.tag), dv.short_name);
+    } else {
+        snprintf(cmd, len, "%s/%s", device_type_2_device_name(device_type_), dv.short_name);
+    }
+    return cmd;
+}
+
 // looks up the UOM for a given key from the device value table
 std::string EMSdevice::get_value_uom(const std::string & shortname) const {
-    for (const auto & dv : devicevalues_) {
-        if ((!dv.has_state(DeviceValueState::DV_WEB_EXCLUDE)) && (dv.short_name == shortname)) {
-            // ignore TIME since "minutes" is already added to the string value
-            if ((dv.uom == DeviceValueUOM::NONE) || (dv.uom == DeviceValueUOM::MINUTES)) {
-                break;
-            }
-            return EMSdevice::uom_to_string(dv.uom);
-        }
+    int slot = find_short_name(shortname.c_str(), [&](const DeviceValue & dv) {
+        return (!dv.has_state(DeviceValueState::DV_WEB_EXCLUDE)) && (dv.short_name == shortname);
+    });
+    if (slot < 0) {
+        return std::string{}; // not found
     }
 
-    return std::string{}; // not found
+    // ignore TIME since "minutes" is already added to the string value
+    const auto & dv = devicevalues_[slot];
+    if ((dv.uom == DeviceValueUOM::NONE) || (dv.uom == DeviceValueUOM::MINUTES)) {
+        return std::string{};
+    }
+    return EMSdevice::uom_to_string(dv.uom);
 }
 
 bool EMSdevice::export_values(uint8_t device_type, JsonObject output, const int8_t id, const uint8_t output_target) {
@@ -1544,21 +1611,101 @@ bool EMSdevice::get_value_info(JsonObject output, const char * cmd, const int8_t
     char cmd_s[COMMAND_MAX_LENGTH];
     strlcpy(cmd_s, cmd, sizeof(cmd_s));
     const char * attribute_s = Command::get_attribute(cmd_s);
-    for (auto & dv : devicevalues_) {
-        if (cmd_s == Helpers::toLower(dv.short_name) && (tag <= 0 || tag == dv.tag)) {
-            get_value_json(output, dv);
-            // if we're filtering on an attribute, go find it
-            // if we can't find it, maybe it exists but doesn't not have a value assigned yet
-            return Command::get_attribute(output, cmd_s, attribute_s);
+    int          slot        = find_short_name(cmd_s, [&](const DeviceValue & dv) { return tag <= 0 || tag == dv.tag; });
+    if (slot < 0) {
+        return false; // not found, but don't return a message error yet
+    }
+
+    get_value_json(output, devicevalues_[slot]);
+    // if we're filtering on an attribute, go find it
+    // if we can't find it, maybe it exists but doesn't not have a value assigned yet
+    return Command::get_attribute(output, cmd_s, attribute_s);
+}
+
+// slot of the entity get_value_info() would return for this name and tag, -1 if not found
+int EMSdevice::get_value_slot(const char * cmd, const int8_t id) const {
+    return find_short_name(cmd, [&](const DeviceValue & dv) { return id <= 0 || id == dv.tag; });
+}
+
+// the "value" attribute of an entity as get_value_json() renders it, without building the json
+// returns false if the entity has no value
+bool EMSdevice::get_value_string(const uint16_t slot, std::string & value) const {
+    char         val[55];
+    const char * text = value_text(devicevalues_[slot], val, sizeof(val));
+    if (text == nullptr) {
+        return false;
+    }
+    value = text;
+    return true;
+}
+
+// render the value of an entity as text into val, numbers as plain json numbers
+// and booleans as Mqtt::add_value_bool() writes them. Returns nullptr if the entity has no value
+char * EMSdevice::value_text(const DeviceValue & dv, char * val, const size_t size) {
+    uint8_t fahrenheit = !EMSESP::system_.fahrenheit() ? 0 : (dv.uom == DeviceValueUOM::DEGREES) ? 2 : (dv.uom == DeviceValueUOM::DEGREES_R) ? 1 : 0;
+
+    switch (dv.type) {
+    case DeviceValueType::ENUM:
+        if (*(uint8_t *)(dv.value_p) >= dv.options_size) {
+            return nullptr;
+        }
+        if (EMSESP::system_.enum_format() == ENUM_FORMAT_INDEX) {
+            return Helpers::itoa((int32_t)(*(uint8_t *)(dv.value_p)), val);
+        }
+        strlcpy(val, Helpers::translated_word(dv.options[*(uint8_t *)(dv.value_p)]), size);
+        return val;
+
+    case DeviceValueType::UINT16:
+        if (!Helpers::hasValue(*(uint16_t *)(dv.value_p))) {
+            return nullptr;
+        }
+        return Helpers::render_value(val, *(uint16_t *)(dv.value_p), dv.numeric_operator, fahrenheit);
+
+    case DeviceValueType::UINT8:
+        if (!Helpers::hasValue(*(uint8_t *)(dv.value_p))) {
+            return nullptr;
         }
+        return Helpers::render_value(val, *(uint8_t *)(dv.value_p), dv.numeric_operator, fahrenheit);
+
+    case DeviceValueType::INT16:
+        if (!Helpers::hasValue(*(int16_t *)(dv.value_p))) {
+            return nullptr;
+        }
+        return Helpers::render_value(val, *(int16_t *)(dv.value_p), dv.numeric_operator, fahrenheit);
+
+    case DeviceValueType::INT8:
+        if (!Helpers::hasValue(*(int8_t *)(dv.value_p))) {
+            return nullptr;
+        }
+        return Helpers::render_value(val, *(int8_t *)(dv.value_p), dv.numeric_operator, fahrenheit);
+
+    case DeviceValueType::UINT24:
+    case DeviceValueType::UINT32:
+    case DeviceValueType::TIME:
+        if (!Helpers::hasValue(*(uint32_t *)(dv.value_p))) {
+            return nullptr;
+        }
+        return Helpers::render_value(val, *(uint32_t *)(dv.value_p), dv.numeric_operator);
+
+    case DeviceValueType::BOOL:
+        if (!Helpers::hasValue(*(uint8_t *)(dv.value_p), EMS_VALUE_BOOL)) {
+            return nullptr;
+        }
+        return Helpers::render_boolean(val, (bool)*(uint8_t *)(dv.value_p));
+
+    case DeviceValueType::STRING:
+        if (!Helpers::hasValue((char *)(dv.value_p))) {
+            return nullptr;
+        }
+        return Helpers::render_string(val, (char *)(dv.value_p), size);
+
+    default:
+        return nullptr;
     }
-    return false; // not found, but don't return a message error yet
 }
 
 // build the json for a specific entity
 void EMSdevice::get_value_json(JsonObject json, DeviceValue & dv) {
-    uint8_t fahrenheit = !EMSESP::system_.fahrenheit() ? 0 : (dv.uom == DeviceValueUOM::DEGREES) ? 2 : (dv.uom == DeviceValueUOM::DEGREES_R) ? 1 : 0;
-
     const char * type  = "type";
     const char * value = "value";
 
@@ -1576,10 +1723,11 @@ void EMSdevice::get_value_json(JsonObject json, DeviceValue & dv) {
         json["circuit"] = tag_to_mqtt(dv.tag);
     }
 
-    char val[20];
+    char   val[55];
+    char * text = value_text(dv, val, sizeof(val));
     switch (dv.type) {
     case DeviceValueType::ENUM: {
-        if (*(uint8_t *)(dv.value_p) < dv.options_size) {
+        if (text) {
             json["index"] = (uint8_t)(*(uint8_t *)(dv.value_p));
             json["enum"]  = Helpers::translated_word(dv.options[*(uint8_t *)(dv.value_p)]); // text
             if (EMSESP::system_.enum_format() == ENUM_FORMAT_INDEX) {
@@ -1597,43 +1745,20 @@ void EMSdevice::get_value_json(JsonObject json, DeviceValue & dv) {
     }
 
     case DeviceValueType::UINT16:
-        if (Helpers::hasValue(*(uint16_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(uint16_t *)(dv.value_p), dv.numeric_operator, fahrenheit));
-        }
-        json[type] = F_(number);
-        break;
-
     case DeviceValueType::UINT8:
-        if (Helpers::hasValue(*(uint8_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(uint8_t *)(dv.value_p), dv.numeric_operator, fahrenheit));
-        }
-        json[type] = F_(number);
-        break;
-
     case DeviceValueType::INT16:
-        if (Helpers::hasValue(*(int16_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(int16_t *)(dv.value_p), dv.numeric_operator, fahrenheit));
-        }
-        json[type] = F_(number);
-        break;
-
     case DeviceValueType::INT8:
-        if (Helpers::hasValue(*(int8_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(int8_t *)(dv.value_p), dv.numeric_operator, fahrenheit));
-        }
-        json[type] = F_(number);
-        break;
-
     case DeviceValueType::UINT24:
     case DeviceValueType::UINT32:
-        if (Helpers::hasValue(*(uint32_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(uint32_t *)(dv.value_p), dv.numeric_operator));
+    case DeviceValueType::TIME:
+        if (text) {
+            json[value] = serialized(text);
         }
         json[type] = F_(number);
         break;
 
     case DeviceValueType::BOOL:
-        if (Helpers::hasValue(*(uint8_t *)(dv.value_p), EMS_VALUE_BOOL)) {
+        if (text) {
             auto value_b  = (bool)*(uint8_t *)(dv.value_p);
             json["bool"]  = value_b;
             json["index"] = value_b ? 1 : 0;
@@ -1642,17 +1767,9 @@ void EMSdevice::get_value_json(JsonObject json, DeviceValue & dv) {
         json[type] = ("boolean");
         break;
 
-    case DeviceValueType::TIME:
-        if (Helpers::hasValue(*(uint32_t *)(dv.value_p))) {
-            json[value] = serialized(Helpers::render_value(val, *(uint32_t *)(dv.value_p), dv.numeric_operator));
-        }
-        json[type] = F_(number);
-        break;
-
     case DeviceValueType::STRING:
-        if (Helpers::hasValue((char *)(dv.value_p))) {
-            char s[55];
-            json[value] = Helpers::render_string(s, (char *)(dv.value_p), sizeof(s));
+        if (text) {
+            json[value] = text;
         }
         json[type] = ("string");
         break;
@@ -1922,7 +2039,14 @@ bool EMSdevice::generate_values(JsonObject output, const int8_t tag_filter, cons
     uint8_t    old_tag    = 255;   // NAN
     JsonObject json       = output;
 
-    for (auto & dv : devicevalues_) {
+    // with a tag filter only the values with that tag are visited, otherwise all in registration order
+    const bool   all_tags = (tag_filter == DeviceValueTAG::TAG_NONE);
+    auto         range    = find_tag_range(tag_filter);
+    const size_t count    = all_tags ? devicevalues_.size() : range.second - range.first;
+
+    for (size_t i = 0; i < count; i++) {
+        auto & dv = devicevalues_[all_tags ? i : range.first[i]];
+
         // check if it exists, there is a value for the entity. Set the flag to ACTIVE
         // not that this will override any previously removed states
         (dv.hasValue()) ? dv.add_state(DeviceValueState::DV_ACTIVE) : dv.remove_state(DeviceValueState::DV_ACTIVE);
@@ -2089,6 +2213,11 @@ void EMSdevice::mqtt_ha_entity_config_create() {
     // check the state of each of the device values
     // create the discovery topic if if hasn't already been created, not a command (like reset) and is active and visible
     for (auto & dv : devicevalues_) {
+        // the rest is created with a next publish, when the HA queue has room again
+        if (Mqtt::publish_room(Mqtt::PRIORITY_HA) < 2) {
+            break;
+        }
+
         // create climate when we reach the haclimate entity
         if (!strcmp(dv.short_name, FL_(haclimate)[0]) && !dv.has_state(DeviceValueState::DV_API_MQTT_EXCLUDE) && dv.has_state(DeviceValueState::DV_ACTIVE)) {
             int8_t haclimate_value    = *(int8_t *)(dv.value_p);
@@ -2180,16 +2309,16 @@ bool EMSdevice::has_telegram_id(uint16_t id) const {
 }
 
 // return the name of the telegram type
-const char * EMSdevice::telegram_type_name(std::shared_ptr<const Telegram> telegram) {
+const char * EMSdevice::telegram_type_name(const Telegram & telegram) {
     // see if it's one of the common ones, like Version
-    if (telegram->type_id == EMS_TYPE_VERSION) {
+    if (telegram.type_id == EMS_TYPE_VERSION) {
         return "Version";
-    } else if (telegram->type_id == EMS_TYPE_UBADevices) {
+    } else if (telegram.type_id == EMS_TYPE_UBADevices) {
         return "UBADevices";
     }
 
     for (const auto & tf : telegram_functions_) {
-        if ((tf.telegram_type_id_ == telegram->type_id) && (telegram->type_id != 0xFF)) {
+        if ((tf.telegram_type_id_ == telegram.type_id) && (telegram.type_id != 0xFF)) {
             return tf.telegram_type_name_;
         }
     }
@@ -2197,38 +2326,58 @@ const char * EMSdevice::telegram_type_name(std::shared_ptr<const Telegram> teleg
     return "";
 }
 
-// take a telegram_type_id and call the matching handler
-// return true if match found
-bool EMSdevice::handle_telegram(std::shared_ptr<const Telegram> telegram) {
-    for (auto & tf : telegram_functions_) {
-        if (tf.telegram_type_id_ == telegram->type_id) {
-            // for telegram destination only read telegram
-            if (telegram->dest == device_id_ && telegram->message_length > 0) {
-                tf.process_function_(telegram);
-                return true;
-            }
-            // if the data block is empty and we have not received data before, assume that this telegram
-            // is not recognized by the bus master. So remove it from the automatic fetch list
-            if (telegram->message_length == 0 && telegram->offset == 0 && !tf.received_) {
+// add an entry for each registered telegram type to the dispatch index
+// for duplicate type_ids the first registered handler is used, see EMSESP::build_telegram_dispatch()
+void EMSdevice::add_telegram_dispatch(std::vector<TelegramDispatch, AllocatorPSRAM<TelegramDispatch>> & dispatch) {
+    for (uint16_t i = 0; i < telegram_functions_.size(); i++) {
+        dispatch.push_back({telegram_dispatch_key(device_id_, telegram_functions_[i].telegram_type_id_), this, i});
+    }
+}
+
+// call the handler at index in telegram_functions_, found with the dispatch index
+// return true if the telegram was handled
+bool EMSdevice::handle_telegram(const Telegram & telegram, const uint16_t index) {
+    auto & tf = telegram_functions_[index];
+
+    // for telegram destination only read telegram
+    if (telegram.dest == device_id_ && telegram.message_length > 0) {
+        tf.process_function_(telegram);
+        return true;
+    }
+    // if the data block is empty and we have not received data before, assume that this telegram
+    // is not recognized by the bus master. So remove it from the automatic fetch list
+    if (telegram.message_length == 0 && telegram.offset == 0 && !tf.received_) {
 #if defined(EMSESP_DEBUG)
-                EMSESP::logger().debug("This telegram (%s) is not recognized by the EMS bus", tf.telegram_type_name_);
+        EMSESP::logger().debug("This telegram (%s) is not recognized by the EMS bus", tf.telegram_type_name_);
 #endif
-                // removing fetch after start causes issue: https://github.com/emsesp/EMS-ESP32/issues/1420
-                // continue retry the first 5 minutes, then disable (added 15.3.2024)
-                if (uuid::get_uptime_sec() > 600) {
-                    tf.fetch_ = false;
-                }
-                return false;
-            }
-            if (telegram->message_length > 0) {
-                tf.received_ = true;
-                tf.process_function_(telegram);
-            }
+        // removing fetch after start causes issue: https://github.com/emsesp/EMS-ESP32/issues/1420
+        // continue retry the first 5 minutes, then disable (added 15.3.2024)
+        if (uuid::get_uptime_sec() > 600) {
+            tf.fetch_ = false;
+        }
+        return false;
+    }
+    if (telegram.message_length > 0) {
+        tf.received_ = true;
 
-            return true;
+        // see if the data changed, by the values or the first block, to adapt the fetch interval
+        bool has_update = has_update_;
+        has_update_     = false;
+        tf.process_function_(telegram);
+        bool changed = has_update_;
+        if (telegram.offset == 0) {
+            uint32_t hash = Helpers::hash_data(telegram.message_data, telegram.message_length);
+            changed |= hash != tf.data_hash_;
+            tf.data_hash_ = hash;
+        }
+        has_update_ |= has_update;
+        tf.fetch_backoff_ = changed ? 0 : std::min<uint8_t>(tf.fetch_backoff_ + 1, FETCH_MAX_BACKOFF);
+        if ((telegram.dest & 0x7F) != EMSbus::ems_bus_id()) {
+            tf.broadcast_time_ = uuid::get_uptime();
         }
     }
-    return false; // type not found
+
+    return true;
 }
 
 // send Tx write with a data block
@@ -2268,13 +2417,12 @@ std::string EMSdevice::name() {
 // returns true on success.
 int EMSdevice::get_modbus_value(uint8_t tag, const std::string & shortname, std::vector<uint16_t> & result) {
     // find device value by shortname
-    // TODO replace linear search which is inefficient
-    const auto & it = std::find_if(devicevalues_.begin(), devicevalues_.end(), [&](const DeviceValue & x) { return x.tag == tag && x.short_name == shortname; });
-    if (it == devicevalues_.end() && (it->short_name != shortname || it->tag != tag)) {
+    int slot = find_short_name(shortname.c_str(), [&](const DeviceValue & x) { return x.tag == tag && x.short_name == shortname; });
+    if (slot < 0) {
         return -1;
     }
 
-    auto & dv = *it;
+    auto & dv = devicevalues_[slot];
 
     // check if it exists, there is a value for the entity. Set the flag to ACTIVE
     // not that this will override any previously removed states
@@ -2356,12 +2504,12 @@ int EMSdevice::modbus_value_to_json(uint8_t tag, const std::string & shortname,
     // LOG_DEBUG("modbus_value_to_json(%d,%s,[%d bytes])\n", tag, shortname.c_str(), modbus_data.size());
 
     // find device value by shortname
-    const auto & it = std::find_if(devicevalues_.begin(), devicevalues_.end(), [&](const DeviceValue & x) { return x.tag == tag && x.short_name == shortname; });
-    if (it == devicevalues_.end() && (it->short_name != shortname || it->tag != tag)) {
+    int slot = find_short_name(shortname.c_str(), [&](const DeviceValue & x) { return x.tag == tag && x.short_name == shortname; });
+    if (slot < 0) {
         return -1;
     }
 
-    auto & dv = *it;
+    auto & dv = devicevalues_[slot];
 
     // handle Booleans
     if (dv.type == DeviceValueType::BOOL) {
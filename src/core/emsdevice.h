@@ -34,7 +34,7 @@ class EMSdevice {
   public:
     virtual ~EMSdevice() = default; // destructor of base class must always be virtual because it's a polymorphic class
 
-    using process_function_p = std::function<void(std::shared_ptr<const Telegram>)>;
+    using process_function_p = std::function<void(const Telegram &)>;
 
     // device_type defines which derived class to use, e.g. BOILER, THERMOSTAT etc..
     EMSdevice(uint8_t device_type, uint8_t device_id, uint8_t product_id, const char * version, const char * default_name, uint8_t flags, uint8_t brand)
@@ -194,16 +194,16 @@ class EMSdevice {
         }
     }
 
-    void has_enumupdate(std::shared_ptr<const Telegram> telegram, uint8_t & value, const uint8_t index, int8_t s = 0) {
-        if (telegram->read_enumvalue(value, index, s)) {
+    void has_enumupdate(const Telegram & telegram, uint8_t & value, const uint8_t index, int8_t s = 0) {
+        if (telegram.read_enumvalue(value, index, s)) {
             has_update_ = true;
             publish_value((void *)&value);
         }
     }
 
-    void has_enumupdate(std::shared_ptr<const Telegram> telegram, uint8_t & value, const uint8_t index, const std::vector<uint8_t> & maskIn) {
+    void has_enumupdate(const Telegram & telegram, uint8_t & value, const uint8_t index, const std::vector<uint8_t> & maskIn) {
         uint8_t val = value < maskIn.size() ? maskIn[value] : EMS_VALUE_UINT8_NOTSET;
-        if (telegram->read_value(val, index)) {
+        if (telegram.read_value(val, index)) {
             for (uint8_t i = 0; i < maskIn.size(); i++) {
                 if (val == maskIn[i]) {
                     value       = i;
@@ -216,16 +216,16 @@ class EMSdevice {
     }
 
     template <typename Value>
-    void has_update(std::shared_ptr<const Telegram> telegram, Value & value, const uint8_t index, uint8_t s = 0) {
-        if (telegram->read_value(value, index, s)) {
+    void has_update(const Telegram & telegram, Value & value, const uint8_t index, uint8_t s = 0) {
+        if (telegram.read_value(value, index, s)) {
             has_update_ = true;
             publish_value((void *)&value);
         }
     }
 
     template <typename BitValue>
-    void has_bitupdate(std::shared_ptr<const Telegram> telegram, BitValue & value, const uint8_t index, uint8_t b) {
-        if (telegram->read_bitvalue(value, index, b)) {
+    void has_bitupdate(const Telegram & telegram, BitValue & value, const uint8_t index, uint8_t b) {
+        if (telegram.read_bitvalue(value, index, b)) {
             has_update_ = true;
             publish_value((void *)&value);
         }
@@ -247,11 +247,24 @@ class EMSdevice {
     void getCustomizationEntities(std::vector<std::string> & entity_ids);
 
     void register_telegram_type(const uint16_t telegram_type_id, const char * telegram_type_name, bool fetch, const process_function_p cb);
-    bool handle_telegram(std::shared_ptr<const Telegram> telegram);
+    bool handle_telegram(const Telegram & telegram, const uint16_t index);
+
+    // entry in the telegram dispatch index, see EMSESP::build_telegram_dispatch()
+    struct TelegramDispatch {
+        uint32_t    key_;    // see telegram_dispatch_key()
+        EMSdevice * device_; // the device with the handler
+        uint16_t    index_;  // index of the handler in the device's telegram_functions_
+    };
+    static uint32_t telegram_dispatch_key(const uint8_t device_id, const uint16_t type_id) {
+        return ((uint32_t)(device_id & 0x7F) << 16) | type_id;
+    }
+    void add_telegram_dispatch(std::vector<TelegramDispatch, AllocatorPSRAM<TelegramDispatch>> & dispatch);
 
     std::string get_value_uom(const std::string & shortname) const;
     bool        get_value_info(JsonObject root, const char * cmd, const int8_t id);
     void        get_value_json(JsonObject output, DeviceValue & dv);
+    int         get_value_slot(const char * cmd, const int8_t id) const;
+    bool        get_value_string(const uint16_t slot, std::string & value) const;
     std::string get_metrics_prometheus(const int8_t tag = -1);
     void        get_dv_info(JsonObject json);
 
@@ -342,10 +355,11 @@ class EMSdevice {
     bool         has_command(const void * value_p) const;
     void         set_minmax(const void * value_p, int16_t min, uint32_t max);
     void         publish_value(void * value_p) const;
+    char *       value_cmd(char * cmd, const size_t len, const DeviceValue & dv) const;
     void         publish_all_values();
     void         mqtt_ha_entity_config_create();
-    const char * telegram_type_name(std::shared_ptr<const Telegram> telegram);
-    void         fetch_values();
+    const char * telegram_type_name(const Telegram & telegram);
+    void         fetch_values(const bool scheduled = false);
     void         toggle_fetch(uint16_t telegram_id, bool toggle);
     bool         is_fetch(uint16_t telegram_id) const;
     bool         is_received(uint16_t telegram_id) const;
@@ -405,6 +419,7 @@ class EMSdevice {
     };
 
     static constexpr uint8_t EMS_DEVICES_MAX_TELEGRAMS = 20;
+    static constexpr uint8_t FETCH_MAX_BACKOFF         = 4; // unchanged telegrams are still fetched every 16th cycle
 
     // static device IDs
     static constexpr uint8_t EMS_DEVICE_ID_BOILER         = 0x08; // fixed device_id for Master Boiler/UBA
@@ -540,6 +555,10 @@ class EMSdevice {
         bool                     fetch_;              // if this type_id be queried automatically
         bool                     received_;
         const process_function_p process_function_;
+        uint8_t                  fetch_backoff_  = 0; // scheduled fetch every 2^n cycles, raised while the data doesn't change
+        uint8_t                  fetch_skipped_  = 0; // scheduled fetches skipped since the last one
+        uint32_t                 broadcast_time_ = 0; // uptime when last seen not as a reply to us
+        uint32_t                 data_hash_      = 0; // of the first block, to see if it changed
 
         TelegramFunction(uint16_t telegram_type_id, const char * telegram_type_name, bool fetch, bool received, const process_function_p process_function)
             : telegram_type_id_(telegram_type_id)
@@ -556,6 +575,24 @@ class EMSdevice {
 #endif
     std::vector<TelegramFunction, AllocatorPSRAM<TelegramFunction>> telegram_functions_; // each EMS device has its own set of registered telegram types
     std::vector<DeviceValue, AllocatorPSRAM<DeviceValue>>           devicevalues_;       // all the device values
+
+  private:
+    std::vector<uint16_t, AllocatorPSRAM<uint16_t>> value_index_; // slots in devicevalues_ sorted by value_p, for publish_value()
+    std::vector<uint16_t, AllocatorPSRAM<uint16_t>> tag_index_;   // slots in devicevalues_ sorted by tag, for generate_values()
+
+    // entry in the short name index, see find_short_name()
+    struct ShortNameIndex {
+        uint32_t hash_; // Helpers::hash_lower() of the short name
+        uint16_t slot_; // index in devicevalues_
+    };
+    std::vector<ShortNameIndex, AllocatorPSRAM<ShortNameIndex>> name_index_; // sorted by hash
+
+    std::vector<uint16_t, AllocatorPSRAM<uint16_t>>::const_iterator find_value_index(const void * value_p) const;
+    std::pair<const uint16_t *, const uint16_t *>                   find_tag_range(const int8_t tag) const;
+    template <typename F>
+    int find_short_name(const char * name, F match) const;
+
+    static char * value_text(const DeviceValue & dv, char * val, const size_t size);
 };
 
 } // namespace emsesp
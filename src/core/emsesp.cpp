@@ -29,8 +29,11 @@ static_assert(uuid::console::thread_safe, "uuid-console must be thread-safe");
 namespace emsesp {
 
 // Static member definitions
-std::vector<std::unique_ptr<EMSdevice>, AllocatorPSRAM<std::unique_ptr<EMSdevice>>> EMSESP::emsdevices{};
-std::vector<EMSESP::Device_record, AllocatorPSRAM<EMSESP::Device_record>>           EMSESP::device_library_;
+std::vector<std::unique_ptr<EMSdevice>, AllocatorPSRAM<std::unique_ptr<EMSdevice>>>   EMSESP::emsdevices{};
+std::vector<EMSESP::Device_record, AllocatorPSRAM<EMSESP::Device_record>>             EMSESP::device_library_;
+std::vector<EMSdevice::TelegramDispatch, AllocatorPSRAM<EMSdevice::TelegramDispatch>> EMSESP::telegram_dispatch_;
+bool                                                                                  EMSESP::telegram_dispatch_dirty_ = false;
+uint32_t                                                                              EMSESP::entity_bindings_version_ = 1;
 
 uuid::log::Logger EMSESP::logger_{F_(emsesp), uuid::log::Facility::KERN};
 uint16_t          EMSESP::watch_id_         = WATCH_ID_NONE;
@@ -286,28 +289,52 @@ void EMSESP::show_ems(uuid::console::Shell & shell) {
         shell.printfln("  #read requests sent: %d", txservice_.telegram_read_count());
         shell.printfln("  #write requests sent: %d", txservice_.telegram_write_count());
         shell.printfln("  #incomplete telegrams: %d", rxservice_.telegram_error_count());
+        shell.printfln("  #dropped telegrams (Rx queue full): %d", rxservice_.frame_overflow_count());
+        shell.printfln("  #telegram pool: %d/%d in use, %d allocated from heap", TelegramPool::in_use(), TelegramPool::size(), TelegramPool::fallback_count());
         shell.printfln("  #read fails (after %d retries): %d", TxService::MAXIMUM_TX_RETRIES, txservice_.telegram_read_fail_count());
         shell.printfln("  #write fails (after %d retries): %d", TxService::MAXIMUM_TX_RETRIES, txservice_.telegram_write_fail_count());
         shell.printfln("  Rx line quality: %d%%", rxservice_.quality());
         shell.printfln("  Tx line quality: %d%%", (txservice_.read_quality() + txservice_.write_quality()) / 2);
+        if (BusCapture::active() || BusCapture::frames()) {
+            shell.printfln("  Bus capture: %s, %d frames, %d dropped", BusCapture::active() ? "running" : "stopped", BusCapture::frames(), BusCapture::dropped());
+        }
+        shell.println();
+
+        // bus timing, the percentiles are the upper limit of their histogram bucket
+        shell.printfln("EMS Bus timing (p50/p95/max):");
+        auto show_timing = [&](const char * name, const Histogram & histogram, const char * unit) {
+            shell.printfln("  %s: %d/%d/%d %s (%d telegrams)", name, histogram.percentile(50), histogram.percentile(95), histogram.max(), unit, histogram.count());
+        };
+        show_timing("Poll to send", EMSbus::poll_to_send_, "us");
+        show_timing("Tx to reply", EMSbus::tx_to_reply_, "us");
+        show_timing("Write to ack", EMSbus::write_to_ack_, "ms");
+        show_timing("Rx queue time", EMSbus::rx_queue_time_, "us");
+        const auto & retries = EMSbus::tx_retries_;
+        shell.printfln("  #retries per telegram: 0: %d, 1: %d, 2: %d, 3: %d, failed: %d",
+                       retries.count(0),
+                       retries.count(1),
+                       retries.count(2),
+                       retries.count(3),
+                       retries.count(TxService::MAXIMUM_TX_RETRIES + 1));
         shell.println();
     }
 
-    // Rx queue
-    auto rx_telegrams = rxservice_.queue();
-    if (rx_telegrams.empty()) {
+    // Rx queue, raw frames not yet decoded
+    auto rx_frames = rxservice_.frames_pending();
+    if (rx_frames == 0) {
         shell.printfln("Rx Queue is empty");
     } else {
-        shell.printfln("Rx Queue (%ld telegram%s):", rx_telegrams.size(), rx_telegrams.size() == 1 ? "" : "s");
-        for (const auto & it : rx_telegrams) {
-            shell.printfln(" [%02d] %s", it.id_, pretty_telegram(it.telegram_).c_str());
+        shell.printfln("Rx Queue (%ld telegram%s):", rx_frames, rx_frames == 1 ? "" : "s");
+        for (uint8_t i = 0; i < rx_frames; i++) {
+            const auto & frame = rxservice_.pending_frame(i);
+            shell.printfln(" [%02d] %s", i, frame.length_ ? Helpers::data_to_hex(frame.data_, frame.length_).c_str() : "<empty>");
         }
     }
 
     shell.println();
 
     // Tx queue
-    auto tx_telegrams = txservice_.queue();
+    const auto & tx_telegrams = txservice_.queue();
     if (tx_telegrams.empty()) {
         shell.printfln("Tx Queue is empty");
     } else {
@@ -322,7 +349,7 @@ void EMSESP::show_ems(uuid::console::Shell & shell) {
             } else if ((it.telegram_->operation) == Telegram::Operation::TX_WRITE) {
                 op = "WRITE";
             }
-            shell.printfln(" [%02d%c] %s %s", it.id_, ((it.retry_) ? '*' : ' '), op.c_str(), pretty_telegram(it.telegram_).c_str());
+            shell.printfln(" [%02d%c] %s %s", it.id_, ((it.retry_) ? '*' : ' '), op.c_str(), pretty_telegram(*it.telegram_).c_str());
         }
     }
 
@@ -593,8 +620,9 @@ void EMSESP::publish_all_loop() {
         return;
     }
 
-    // wait for free queue before sending next message, HA-messages are also queued
-    if (Mqtt::publish_queued() > 0) {
+    // wait until the device publishes are sent before sending the next, HA-messages go on in the background
+    // as long as the HA queue has room for half a queue of configs, so every device gets its turn
+    if (Mqtt::publish_queued(Mqtt::PRIORITY_DEVICE) > 0 || Mqtt::publish_room(Mqtt::PRIORITY_HA) < Mqtt::MQTT_QUEUE_MAX_SIZE / 2) {
         return;
     }
 
@@ -733,18 +761,18 @@ void EMSESP::publish_sensor_values(const bool time, const bool force) {
 }
 
 // MQTT publish a telegram as raw data to the topic 'response'
-void EMSESP::publish_response(std::shared_ptr<const Telegram> telegram) {
+void EMSESP::publish_response(const Telegram & telegram) {
     static char *   buffer = nullptr;
     static uint8_t  offset = 0;
     static uint16_t type   = 0;
     // restart on mismatch while collecting telegram
-    if (buffer && (telegram->offset < offset || telegram->type_id != type)) {
+    if (buffer && (telegram.offset < offset || telegram.type_id != type)) {
         delete[] buffer;
         buffer = nullptr;
     }
     if (buffer == nullptr) {
-        offset = telegram->offset; // store offset from first part
-        type   = telegram->type_id;
+        offset = telegram.offset; // store offset from first part
+        type   = telegram.type_id;
         buffer = new char[768]; // max 256 hex-codes, 255 spaces, 1 termination
         for (uint16_t i = 0; i < 256; i++) {
             buffer[i * 3]     = '0';
@@ -753,10 +781,10 @@ void EMSESP::publish_response(std::shared_ptr<const Telegram> telegram) {
         }
         buffer[267] = '\0';
     }
-    if (telegram->message_length) {
-        strlcpy(&buffer[(telegram->offset - offset) * 3], Helpers::data_to_hex(telegram->message_data, telegram->message_length).c_str(), 768);
+    if (telegram.message_length) {
+        strlcpy(&buffer[(telegram.offset - offset) * 3], Helpers::data_to_hex(telegram.message_data, telegram.message_length).c_str(), 768);
     } else {
-        strlcpy(&buffer[(telegram->offset - offset) * 3], "", 768);
+        strlcpy(&buffer[(telegram.offset - offset) * 3], "", 768);
     }
     if (response_id_ != 0) {
         buffer[strlen(buffer)] = ' '; // overwrite termination \0
@@ -764,9 +792,9 @@ void EMSESP::publish_response(std::shared_ptr<const Telegram> telegram) {
     }
     JsonDocument doc;
     char         s[10];
-    doc["src"]    = Helpers::hextoa(s, telegram->src);
-    doc["dest"]   = Helpers::hextoa(s, telegram->dest);
-    doc["type"]   = Helpers::hextoa(s, telegram->type_id);
+    doc["src"]    = Helpers::hextoa(s, telegram.src);
+    doc["dest"]   = Helpers::hextoa(s, telegram.dest);
+    doc["type"]   = Helpers::hextoa(s, telegram.type_id);
     doc["offset"] = Helpers::hextoa(s, offset);
     doc["data"]   = buffer;
 
@@ -847,10 +875,10 @@ std::string EMSESP::device_tostring(const uint8_t device_id) {
 
 // create a pretty print telegram as a text string
 // e.g. Boiler(0x08) -> Me(0x0B), Version(0x02), data: 7B 06 01 00 00 00 00 00 00 04 (offset 1)
-std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
-    uint8_t src    = telegram->src & 0x7F;
-    uint8_t dest   = telegram->dest & 0x7F;
-    uint8_t offset = telegram->offset;
+std::string EMSESP::pretty_telegram(const Telegram & telegram) {
+    uint8_t src    = telegram.src & 0x7F;
+    uint8_t dest   = telegram.dest & 0x7F;
+    uint8_t offset = telegram.offset;
 
     // find name for src and dest by looking up known devices
     std::string src_name("");
@@ -877,9 +905,9 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
 
         // get the type name (try primary conditions first)
         if (!type_found) {
-            if ((telegram->operation == Telegram::Operation::RX_READ && emsdevice->is_device_id(dest))
-                || (telegram->operation != Telegram::Operation::RX_READ && dest == 0 && emsdevice->is_device_id(src))
-                || (telegram->operation != Telegram::Operation::RX_READ && src == EMSbus::ems_bus_id() && emsdevice->is_device_id(dest))) {
+            if ((telegram.operation == Telegram::Operation::RX_READ && emsdevice->is_device_id(dest))
+                || (telegram.operation != Telegram::Operation::RX_READ && dest == 0 && emsdevice->is_device_id(src))
+                || (telegram.operation != Telegram::Operation::RX_READ && src == EMSbus::ems_bus_id() && emsdevice->is_device_id(dest))) {
                 type_name = emsdevice->telegram_type_name(telegram);
                 if (!type_name.empty()) {
                     type_found = true;
@@ -894,7 +922,7 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
     }
 
     // Fallback for type name if not found - try src first, then dest
-    if (!type_found && telegram->operation != Telegram::Operation::RX_READ) {
+    if (!type_found && telegram.operation != Telegram::Operation::RX_READ) {
         for (int i = 0; i < 2 && type_name.empty(); ++i) {
             uint8_t check_id = (i == 0) ? src : dest;
             for (const auto & emsdevice : emsdevices) {
@@ -920,7 +948,7 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
     // if we don't know the type show
     if (type_name.empty()) {
         // check for global/common types like Version & UBADevices
-        switch (telegram->type_id) {
+        switch (telegram.type_id) {
         case EMSdevice::EMS_TYPE_NAME:
             type_name = "DeviceName";
             break;
@@ -949,7 +977,7 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
 
     // Optimized: Use stack buffer and build string once to avoid multiple temporary allocations
     char buf[250];
-    if (telegram->operation == Telegram::Operation::RX_READ) {
+    if (telegram.operation == Telegram::Operation::RX_READ) {
         auto pos = snprintf(buf,
                             sizeof(buf),
                             "%s(%s) R %s(%s), %s(%s), length: %d",
@@ -958,13 +986,13 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
                             dest_name.c_str(),
                             Helpers::hextoa(dest).c_str(),
                             type_name.c_str(),
-                            Helpers::hextoa(telegram->type_id).c_str(),
-                            telegram->message_data[0]);
-        if (telegram->message_length > 1 && pos > 0 && pos < (int)sizeof(buf)) {
-            std::string data_hex = Helpers::data_to_hex(telegram->message_data + 1, telegram->message_length - 1);
+                            Helpers::hextoa(telegram.type_id).c_str(),
+                            telegram.message_data[0]);
+        if (telegram.message_length > 1 && pos > 0 && pos < (int)sizeof(buf)) {
+            std::string data_hex = Helpers::data_to_hex(telegram.message_data + 1, telegram.message_length - 1);
             snprintf(buf + pos, sizeof(buf) - pos, ", data: %s", data_hex.c_str());
         }
-    } else if (telegram->dest == 0) {
+    } else if (telegram.dest == 0) {
         snprintf(buf,
                  sizeof(buf),
                  "%s(%s) B %s(%s), %s(%s), data: %s",
@@ -973,8 +1001,8 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
                  dest_name.c_str(),
                  Helpers::hextoa(dest).c_str(),
                  type_name.c_str(),
-                 Helpers::hextoa(telegram->type_id).c_str(),
-                 telegram->to_string_message().c_str());
+                 Helpers::hextoa(telegram.type_id).c_str(),
+                 telegram.to_string_message().c_str());
     } else {
         snprintf(buf,
                  sizeof(buf),
@@ -984,8 +1012,8 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
                  dest_name.c_str(),
                  Helpers::hextoa(dest).c_str(),
                  type_name.c_str(),
-                 Helpers::hextoa(telegram->type_id).c_str(),
-                 telegram->to_string_message().c_str());
+                 Helpers::hextoa(telegram.type_id).c_str(),
+                 telegram.to_string_message().c_str());
     }
 
     if (offset) {
@@ -1007,15 +1035,15 @@ std::string EMSESP::pretty_telegram(std::shared_ptr<const Telegram> telegram) {
  * e.g. in example above 1st byte = x0B = b1011 so we have deviceIDs 0x08, 0x09, 0x011
  * and 2nd byte = x80 = b1000 b0000 = deviceID 0x17
  */
-void EMSESP::process_UBADevices(std::shared_ptr<const Telegram> telegram) {
+void EMSESP::process_UBADevices(const Telegram & telegram) {
     // exit it length is incorrect (must be 13 or 15 bytes long)
-    if (telegram->message_length > 15) {
+    if (telegram.message_length > 15) {
         return;
     }
 
     // for each byte, check the bits and determine the device_id
-    for (uint8_t data_byte = 0; data_byte < telegram->message_length; data_byte++) {
-        uint8_t next_byte = telegram->message_data[data_byte];
+    for (uint8_t data_byte = 0; data_byte < telegram.message_length; data_byte++) {
+        uint8_t next_byte = telegram.message_data[data_byte];
         for (uint8_t bit = 0; bit < 8; bit++) {
             uint8_t device_id = ((data_byte + 1) * 8) + bit;
             EMSESP::device_active(device_id, next_byte & 0x01);
@@ -1033,25 +1061,25 @@ void EMSESP::process_UBADevices(std::shared_ptr<const Telegram> telegram) {
 }
 
 // read deviceName from telegram 0x01 offset 27 and set it to custom name
-void EMSESP::process_deviceName(std::shared_ptr<const Telegram> telegram) {
+void EMSESP::process_deviceName(const Telegram & telegram) {
     // exit if only part of name fields
-    if (telegram->offset > 27 || (telegram->offset + telegram->message_length) < 29) {
+    if (telegram.offset > 27 || (telegram.offset + telegram.message_length) < 29) {
         return;
     }
     char name[16];
     // len including zero terminator, if there is one, otherwise copy to end of telegram
     // https://github.com/emsesp/EMS-ESP32/discussions/2482#discussioncomment-12649817
-    uint8_t len = telegram->offset + telegram->message_length - 26;
-    strlcpy(name, (const char *)&telegram->message_data[27 - telegram->offset], len < 16 ? len : 16);
+    uint8_t len = telegram.offset + telegram.message_length - 26;
+    strlcpy(name, (const char *)&telegram.message_data[27 - telegram.offset], len < 16 ? len : 16);
     char * c = name;
     while (isprint(*c)) {
         c++;
     };
     *c = '\0';
     if (strlen(name) > 2) { // https://github.com/emsesp/EMS-ESP32/issues/2166#issuecomment-2454488657
-        LOG_DEBUG("Model name received for device 0x%02X: %s", telegram->src, name);
+        LOG_DEBUG("Model name received for device 0x%02X: %s", telegram.src, name);
         for (const auto & emsdevice : emsdevices) {
-            if (emsdevice->is_device_id(telegram->src)) {
+            if (emsdevice->is_device_id(telegram.src)) {
                 emsdevice->model(name);
                 break;
             }
@@ -1061,31 +1089,31 @@ void EMSESP::process_deviceName(std::shared_ptr<const Telegram> telegram) {
 
 // process the Version telegram (type 0x02), which is a common type
 // e.g. 09 0B 02 00 PP V1 V2
-void EMSESP::process_version(std::shared_ptr<const Telegram> telegram) {
+void EMSESP::process_version(const Telegram & telegram) {
     // check for valid telegram, just in case
-    if (telegram->offset != 0) {
+    if (telegram.offset != 0) {
         return;
     }
 
-    const uint8_t msg_len = telegram->message_length;
+    const uint8_t msg_len = telegram.message_length;
 
     // for empty telegram add device with empty product, version and brand
     if (msg_len == 0) {
-        (void)add_device(telegram->src, 0, "00.00", 0);
+        (void)add_device(telegram.src, 0, "00.00", 0);
         return;
     }
 
     if (msg_len < 3) {
-        (void)add_device(telegram->src, telegram->message_data[0], "00.00", 0);
-        send_read_request(EMSdevice::EMS_TYPE_NAME, telegram->src, 27);
+        (void)add_device(telegram.src, telegram.message_data[0], "00.00", 0);
+        send_read_request(EMSdevice::EMS_TYPE_NAME, telegram.src, 27);
         return;
     }
 
     // check for 2nd subscriber, e.g. 18 0B 02 00 00 00 00 5E 02 01
     uint8_t offset = 0;
-    if (telegram->message_data[0] == 0x00) {
+    if (telegram.message_data[0] == 0x00) {
         // see if we have a 2nd subscriber
-        if (msg_len > 5 && telegram->message_data[3] != 0x00) {
+        if (msg_len > 5 && telegram.message_data[3] != 0x00) {
             offset = 3;
         } else {
             return; // ignore whole telegram
@@ -1093,17 +1121,17 @@ void EMSESP::process_version(std::shared_ptr<const Telegram> telegram) {
     }
 
     // extra details from the telegram
-    uint8_t device_id  = telegram->src;                  // deviceID
-    uint8_t product_id = telegram->message_data[offset]; // productID
+    uint8_t device_id  = telegram.src;                  // deviceID
+    uint8_t product_id = telegram.message_data[offset]; // productID
 
     // get version as XX.XX
     char version[8];
-    snprintf(version, sizeof(version), "%02d.%02d", telegram->message_data[offset + 1], telegram->message_data[offset + 2]);
+    snprintf(version, sizeof(version), "%02d.%02d", telegram.message_data[offset + 1], telegram.message_data[offset + 2]);
 
     // some devices store the protocol type (HT3, Buderus) in the last byte
     uint8_t brand;
     if (msg_len >= 10) {
-        brand = EMSdevice::decode_brand(telegram->message_data[9]);
+        brand = EMSdevice::decode_brand(telegram.message_data[9]);
     } else {
         brand = EMSdevice::Brand::NO_BRAND; // unknown
     }
@@ -1119,10 +1147,10 @@ void EMSESP::process_version(std::shared_ptr<const Telegram> telegram) {
 // but only process if the telegram is sent to us or it's a broadcast (dest=0x00=all)
 // We also check for common telegram types, like the Version(0x02)
 // returns false if there are none found
-bool EMSESP::process_telegram(std::shared_ptr<const Telegram> telegram) {
+bool EMSESP::process_telegram(const Telegram & telegram) {
     // if watching or reading...
-    if ((telegram->type_id == read_id_ || telegram->type_id == response_id_) && (telegram->dest == EMSbus::ems_bus_id())) {
-        if (telegram->type_id == response_id_) {
+    if ((telegram.type_id == read_id_ || telegram.type_id == response_id_) && (telegram.dest == EMSbus::ems_bus_id())) {
+        if (telegram.type_id == response_id_) {
             if (!trace_raw_) {
                 LOG_TRACE("%s", pretty_telegram(telegram).c_str());
             }
@@ -1139,24 +1167,24 @@ bool EMSESP::process_telegram(std::shared_ptr<const Telegram> telegram) {
         }
         read_next_ = false;
     } else if (watch() == WATCH_ON) {
-        if ((watch_id_ == WATCH_ID_NONE) || (telegram->type_id == watch_id_)
-            || ((watch_id_ < 0x80) && ((telegram->src == watch_id_) || (telegram->dest == watch_id_)))) {
+        if ((watch_id_ == WATCH_ID_NONE) || (telegram.type_id == watch_id_)
+            || ((watch_id_ < 0x80) && ((telegram.src == watch_id_) || (telegram.dest == watch_id_)))) {
             LOG_NOTICE("%s", pretty_telegram(telegram).c_str());
         } else if (!trace_raw_) {
             LOG_TRACE("%s", pretty_telegram(telegram).c_str());
         }
-    } else if (!trace_raw_) {
-        LOG_TRACE("%s", pretty_telegram(telegram).c_str());
+    } else if (!trace_raw_ && logger_.enabled(Level::TRACE)) {
+        LOG_TRACE("%s", pretty_telegram(telegram).c_str()); // only build the string when it's logged
     }
 
     // only process broadcast telegrams or ones sent to us on request
-    // if ((telegram->dest != 0x00) && (telegram->dest != EMSbus::ems_bus_id())) {
-    if (telegram->operation == Telegram::Operation::RX_READ) {
+    // if ((telegram.dest != 0x00) && (telegram.dest != EMSbus::ems_bus_id())) {
+    if (telegram.operation == Telegram::Operation::RX_READ) {
         // LOG_DEBUG("read telegram received, not processing");
         return false;
     }
 
-    if (wait_validate_ == telegram->type_id) {
+    if (wait_validate_ == telegram.type_id) {
         wait_validate_ = 0;
     }
 
@@ -1164,13 +1192,13 @@ bool EMSESP::process_telegram(std::shared_ptr<const Telegram> telegram) {
     webCustomEntityService.get_value(telegram);
 
     // check for common types, like the Version(0x02)
-    if (telegram->type_id == EMSdevice::EMS_TYPE_VERSION) {
+    if (telegram.type_id == EMSdevice::EMS_TYPE_VERSION) {
         process_version(telegram);
         return true;
-    } else if (telegram->type_id == EMSdevice::EMS_TYPE_NAME) {
+    } else if (telegram.type_id == EMSdevice::EMS_TYPE_NAME) {
         process_deviceName(telegram);
         return true;
-    } else if (telegram->type_id == EMSdevice::EMS_TYPE_UBADevices) {
+    } else if (telegram.type_id == EMSdevice::EMS_TYPE_UBADevices) {
         // do not flood tx-queue with version requests while waiting for km200
         if (!wait_km_) {
             process_UBADevices(telegram);
@@ -1185,22 +1213,39 @@ bool EMSESP::process_telegram(std::shared_ptr<const Telegram> telegram) {
     bool        telegram_found = false;
     EMSdevice * found_device   = nullptr;
 
-    // check all conditions in one loop
-    for (const auto & emsdevice : emsdevices) {
-        if ((emsdevice->is_device_id(telegram->src) && (telegram->dest == 0 || telegram->dest == EMSbus::ems_bus_id() || telegram->dest == 0x10))
-            || (emsdevice->is_device_id(telegram->dest) && telegram->src != EMSbus::ems_bus_id())) {
-            found_device = emsdevice.get();
-            if (emsdevice->handle_telegram(telegram)) {
+    // the telegram is for the sending device if it's a broadcast or sent to us or the master thermostat,
+    // or for the receiving device if we didn't send it
+    bool for_src  = (telegram.dest == 0 || telegram.dest == EMSbus::ems_bus_id() || telegram.dest == 0x10);
+    bool for_dest = (telegram.src != EMSbus::ems_bus_id());
+
+    // look up the handlers in the dispatch index, in order of emsdevices if both have one
+    if (telegram_dispatch_dirty_) {
+        build_telegram_dispatch();
+    }
+    const EMSdevice::TelegramDispatch * handlers[2] = {for_src ? find_telegram_dispatch(telegram.src, telegram.type_id) : nullptr,
+                                                       for_dest ? find_telegram_dispatch(telegram.dest, telegram.type_id) : nullptr};
+    if (handlers[0] && handlers[1]) {
+        if (handlers[0]->device_ == handlers[1]->device_) {
+            handlers[1] = nullptr;
+        } else if (handlers[1]->device_->device_type() < handlers[0]->device_->device_type()) {
+            std::swap(handlers[0], handlers[1]);
+        }
+    }
+
+    for (const auto handler : handlers) {
+        if (handler) {
+            found_device = handler->device_;
+            if (found_device->handle_telegram(telegram, handler->index_)) {
                 telegram_found = true;
                 if (Mqtt::connected()) {
                     // publish device data if it was a validate after write
-                    if (telegram->type_id == publish_id_ && telegram->dest == EMSbus::ems_bus_id()) {
+                    if (telegram.type_id == publish_id_ && telegram.dest == EMSbus::ems_bus_id()) {
                         publish_id_ = 0;
                         found_device->has_update(false);                    // reset flag
                         publish_device_values(found_device->device_type()); // publish to MQTT if we explicitly have too
                     }
-                    // auto publish: timeinterval 0 and publish single not set, only if queue is empty
-                    else if (mqtt_.get_publish_onchange(found_device->device_type()) && found_device->has_update() && mqtt_.publish_queued() == 0) {
+                    // auto publish: timeinterval 0 and publish single not set, only if no device publishes are waiting
+                    else if (mqtt_.get_publish_onchange(found_device->device_type()) && found_device->has_update() && mqtt_.publish_queued(Mqtt::PRIORITY_DEVICE) == 0) {
                         found_device->has_update(false); // reset flag
                         if (!Mqtt::publish_single()) {
                             publish_device_values(found_device->device_type());
@@ -1211,26 +1256,61 @@ bool EMSESP::process_telegram(std::shared_ptr<const Telegram> telegram) {
             }
         }
     }
+    // no handler, find the device for the unknown telegram handling below
+    if (found_device == nullptr) {
+        for (const auto & emsdevice : emsdevices) {
+            if ((for_src && emsdevice->is_device_id(telegram.src)) || (for_dest && emsdevice->is_device_id(telegram.dest))) {
+                found_device = emsdevice.get();
+            }
+        }
+    }
     // handle unknown telegrams
     if (!telegram_found) {
         // mark nonempty telegrams as ignored
-        if (found_device && telegram->message_length > 0) {
-            found_device->add_handlers_ignored(telegram->type_id);
+        if (found_device && telegram.message_length > 0) {
+            found_device->add_handlers_ignored(telegram.type_id);
         }
         // handle unknown broadcasted telegrams (or send to us)
-        if (telegram->dest == 0 || telegram->dest == EMSbus::ems_bus_id()) {
-            LOG_DEBUG("No telegram type handler found for ID 0x%02X (src 0x%02X)", telegram->type_id, telegram->src);
+        if (telegram.dest == 0 || telegram.dest == EMSbus::ems_bus_id()) {
+            LOG_DEBUG("No telegram type handler found for ID 0x%02X (src 0x%02X)", telegram.type_id, telegram.src);
             if (watch() == WATCH_UNKNOWN) {
                 LOG_NOTICE("%s", pretty_telegram(telegram).c_str());
             }
-            if (!wait_km_ && !found_device && (telegram->src != EMSbus::ems_bus_id()) && (telegram->message_length > 0)) {
-                send_read_request(EMSdevice::EMS_TYPE_VERSION, telegram->src);
+            if (!wait_km_ && !found_device && (telegram.src != EMSbus::ems_bus_id()) && (telegram.message_length > 0)) {
+                send_read_request(EMSdevice::EMS_TYPE_VERSION, telegram.src);
             }
         }
     }
     return telegram_found;
 }
 
+// (re)builds the dispatch index from the telegram handlers of all devices, in the order of emsdevices
+// called when a device is added and before the next telegram when a handler was registered
+void EMSESP::build_telegram_dispatch() {
+    telegram_dispatch_.clear();
+    for (const auto & emsdevice : emsdevices) {
+        emsdevice->add_telegram_dispatch(telegram_dispatch_);
+    }
+
+    // stable, so the first registered handler stays first for duplicates
+    std::stable_sort(telegram_dispatch_.begin(), telegram_dispatch_.end(), [](const EMSdevice::TelegramDispatch & a, const EMSdevice::TelegramDispatch & b) {
+        return a.key_ < b.key_;
+    });
+    telegram_dispatch_dirty_ = false;
+}
+
+// binary search the dispatch index for the handler of a telegram type on a device, nullptr if there is none
+const EMSdevice::TelegramDispatch * EMSESP::find_telegram_dispatch(const uint8_t device_id, const uint16_t type_id) {
+    uint32_t key = EMSdevice::telegram_dispatch_key(device_id, type_id);
+    auto     it  = std::lower_bound(telegram_dispatch_.begin(), telegram_dispatch_.end(), key, [](const EMSdevice::TelegramDispatch & d, uint32_t k) {
+        return d.key_ < k;
+    });
+    if (it == telegram_dispatch_.end() || it->key_ != key) {
+        return nullptr;
+    }
+    return &(*it);
+}
+
 // return true if we have this device already registered
 bool EMSESP::device_exists(const uint8_t device_id) {
     if (emsdevices.empty()) {
@@ -1310,6 +1390,8 @@ bool EMSESP::add_device(const uint8_t device_id, const uint8_t product_id, const
                 return true;
             }
             emsdevices.erase(it); // erase the old device without product_id and re detect
+            telegram_dispatch_changed();
+            entity_bindings_changed();
             break;
         }
     }
@@ -1463,6 +1545,8 @@ bool EMSESP::add_device(const uint8_t device_id, const uint8_t product_id, const
         return a->device_type() < b->device_type();
     });
 
+    build_telegram_dispatch(); // add the new device's telegram handlers
+
     fetch_device_values(device_id); // go and fetch its device entity data
 
     // Print to LOG showing we've added a new device
@@ -1509,11 +1593,14 @@ void EMSESP::send_write_request(const uint16_t type_id, const uint8_t dest, cons
 
 // this is main entry point when data is received on the Rx line, via emsuart library
 // we check if its a complete telegram or just a single byte (which could be a poll or a return status)
-// the CRC check is not done here, only when it's added to the Rx queue with add()
+// this runs in the UART task. Complete telegrams are only pushed as raw frames onto the Rx ring,
+// the CRC check and decoding is done later in the main loop by RxService::loop()
 void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
 #ifdef EMSESP_UART_DEBUG
     static uint32_t rx_time_ = 0;
 #endif
+    BusCapture::record(data, length); // if a capture is running
+
     // check first for echo
     uint8_t first_value = data[0];
     if (((first_value & 0x7F) == EMSbus::ems_bus_id()) && (length > 1)) {
@@ -1524,7 +1611,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
         LOG_TRACE("[UART_DEBUG] Echo after %d ms: %s", ::millis() - rx_time_, Helpers::data_to_hex(data, length).c_str());
 #endif
         // add to RxQueue for log/watch
-        rxservice_.add(data, length);
+        rxservice_.push(data, length);
         return; // it's an echo
     }
 
@@ -1538,6 +1625,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
         if ((tx_state == Telegram::Operation::TX_WRITE) && (length == 1)) {
             if (first_value == TxService::TX_WRITE_SUCCESS) {
                 LOG_DEBUG("Last Tx write successful");
+                txservice_.tx_replied();
                 txservice_.increment_telegram_write_count(); // last tx/write was confirmed ok
                 txservice_.send_poll();                      // close the bus
                 publish_id_ = txservice_.post_send_query();  // follow up with any post-read if set
@@ -1545,6 +1633,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
                 tx_successful = true;
             } else if (first_value == TxService::TX_WRITE_FAIL) {
                 LOG_ERROR("Last Tx write rejected by host");
+                txservice_.tx_replied();
                 txservice_.send_poll(); // close the bus
                 txservice_.reset_retry_count();
                 tx_successful = true; // no retries
@@ -1557,6 +1646,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
             uint8_t dest = data[1];
             if (txservice_.is_last_tx(src, dest)) {
                 LOG_DEBUG("Last Tx read successful");
+                txservice_.tx_replied();
                 txservice_.increment_telegram_read_count();
                 txservice_.reset_retry_count();
                 tx_successful = true;
@@ -1583,6 +1673,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
 
     // check for poll
     if (length == 1) {
+        uint32_t poll_time = ::micros();
         // if ht3 poll must be ems_bus_id else if Buderus poll must be (ems_bus_id | 0x80)
         uint8_t         poll_id      = (first_value ^ 0x80 ^ rxservice_.ems_mask());
         static uint32_t connect_time = 0;
@@ -1614,6 +1705,9 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
         // check for poll to us, if so send top message from Tx queue immediately and quit
         if (poll_id == txservice_.get_send_id()) {
             txservice_.send();
+            if (EMSbus::tx_state() != Telegram::Operation::NONE) {
+                EMSbus::poll_to_send_.add(txservice_.telegram_last_sent() - poll_time);
+            }
         } else {
             // send remote room temperature if active
             Roomctrl::send(poll_id);
@@ -1626,7 +1720,7 @@ void EMSESP::incoming_telegram(uint8_t * data, const uint8_t length) {
 #endif
         Roomctrl::check(data[1], data, length); // check if there is a message for the roomcontroller
 
-        rxservice_.add(data, length); // add to RxQueue
+        rxservice_.push(data, length); // hand over to the main loop
     }
 }
 
@@ -1643,7 +1737,7 @@ void EMSESP::scheduled_fetch_values() {
             uint8_t i = 0;
             for (const auto & emsdevice : emsdevices) {
                 if (++i >= no) {
-                    emsdevice->fetch_values();
+                    emsdevice->fetch_values(true);
                     no++;
                     return;
                 }
@@ -1668,6 +1762,8 @@ EMSESP::EMSESP()
 // start all the core services
 // the services must be loaded in the correct order
 void EMSESP::start() {
+    Command::start(); // this task runs the main loop, commands from other tasks are queued for it
+
 #ifndef EMSESP_STANDALONE
     system_.PSram(ESP.getPsramSize());
 #endif
@@ -1782,6 +1878,7 @@ void EMSESP::start() {
         modbus_->start(1, system_.modbus_port(), system_.modbus_max_clients(), system_.modbus_timeout() * 1000);
     }
 
+    TelegramPool::start();                      // allocate the Rx/Tx telegram pool, before the uart is started
     mqtt_.start();                              // mqtt init
     system_.start();                            // starts commands, led, adc, button, network (sets hostname), syslog & uart
     shower_.start();                            // initialize shower timer and shower alert
@@ -1844,6 +1941,8 @@ void EMSESP::loop() {
 
         // loop through the services
         rxservice_.loop();          // process any incoming Rx telegrams
+        Command::loop();            // run commands from the scheduler, web and modbus tasks
+        BusCapture::loop();         // record the frames of a bus capture
         shower_.loop();             // check for shower on/off
         temperaturesensor_.loop();  // read sensor temperatures
         analogsensor_.loop();       // read analog sensor values
@@ -70,6 +70,7 @@
 #include "shower.h"
 #include "roomcontrol.h"
 #include "command.h"
+#include "buscapture.h"
 
 #include "../emsesp_version.h"
 #include <esp32-psram.h>
@@ -81,7 +82,7 @@ class Module {}; // forward declaration
 #define WATCH_ID_NONE 0 // no watch id set
 
 // helpers for callback functions
-#define MAKE_PF_CB(__f) [&](std::shared_ptr<const Telegram> t) { __f(t); }                  // for Process Function callbacks to EMSDevice::process_function_p
+#define MAKE_PF_CB(__f) [&](const Telegram & t) { __f(t); }                                 // for Process Function callbacks to EMSDevice::process_function_p
 #define MAKE_CF_CB(__f) [&](const char * value, const int8_t id) { return __f(value, id); } // for Command Function callbacks Command::cmd_function_p
 
 namespace emsesp {
@@ -107,6 +108,8 @@ class EMSESP {
 
     static uuid::log::Logger logger();
 
+    static constexpr uint32_t EMS_FETCH_FREQUENCY = 60000; // check every minute
+
     static void publish_device_values(uint8_t device_type);
     static void publish_other_values();
     static void publish_sensor_values(const bool time, const bool force = false);
@@ -120,8 +123,8 @@ class EMSESP {
     static void uart_telegram(const std::vector<uint8_t> & rx_data);
 #endif
 
-    static bool        process_telegram(std::shared_ptr<const Telegram> telegram);
-    static std::string pretty_telegram(std::shared_ptr<const Telegram> telegram);
+    static bool        process_telegram(const Telegram & telegram);
+    static std::string pretty_telegram(const Telegram & telegram);
 
     static void send_read_request(const uint16_t type_id, const uint8_t dest, const uint8_t offset = 0, const uint8_t length = 0, const bool front = false);
     static void send_write_request(const uint16_t type_id,
@@ -220,6 +223,17 @@ class EMSESP {
     static void scheduled_fetch_values();
 
     static bool add_device(const uint8_t device_id, const uint8_t product_id, const char * version, const uint8_t brand);
+
+    static void telegram_dispatch_changed() {
+        telegram_dispatch_dirty_ = true;
+    }
+    // bound references in expressions are resolved again when devices or entities have changed
+    static void entity_bindings_changed() {
+        entity_bindings_version_++;
+    }
+    static uint32_t entity_bindings_version() {
+        return entity_bindings_version_;
+    }
     static void scan_devices();
     static void clear_all_devices();
 
@@ -250,17 +264,19 @@ class EMSESP {
 
   private:
     static std::string device_tostring(const uint8_t device_id);
-    static void        process_UBADevices(std::shared_ptr<const Telegram> telegram);
-    static void        process_deviceName(std::shared_ptr<const Telegram> telegram);
-    static void        process_version(std::shared_ptr<const Telegram> telegram);
-    static void        publish_response(std::shared_ptr<const Telegram> telegram);
+    static void        process_UBADevices(const Telegram & telegram);
+    static void        process_deviceName(const Telegram & telegram);
+    static void        process_version(const Telegram & telegram);
+    static void        publish_response(const Telegram & telegram);
     static void        publish_all_loop();
+    static void        build_telegram_dispatch();
+
+    static const EMSdevice::TelegramDispatch * find_telegram_dispatch(const uint8_t device_id, const uint16_t type_id);
 
     void shell_prompt();
     void start_serial_console();
 
-    static constexpr uint32_t EMS_FETCH_FREQUENCY = 60000; // check every minute
-    static constexpr uint8_t  EMS_WAIT_KM_TIMEOUT = 60;    // wait one minute
+    static constexpr uint8_t EMS_WAIT_KM_TIMEOUT = 60; // wait one minute
 
     struct Device_record {
         uint8_t               product_id;
@@ -270,6 +286,11 @@ class EMSESP {
     };
     static std::vector<Device_record, AllocatorPSRAM<Device_record>> device_library_;
 
+    // all telegram handlers of all devices, sorted by (device_id, type_id)
+    static std::vector<EMSdevice::TelegramDispatch, AllocatorPSRAM<EMSdevice::TelegramDispatch>> telegram_dispatch_;
+    static bool                                                                                   telegram_dispatch_dirty_;
+    static uint32_t                                                                               entity_bindings_version_;
+
     static uint16_t watch_id_;
     static uint8_t  watch_;
     static uint16_t read_id_;
@@ -800,6 +800,24 @@ std::string Helpers::toLower(const char * s) {
     return toLower(std::string(s));
 }
 
+// FNV-1a hash of the lower case string, without making a copy
+uint32_t Helpers::hash_lower(const char * s) {
+    uint32_t hash = 2166136261u;
+    while (*s) {
+        hash = (hash ^ (uint8_t)std::tolower((unsigned char)*s++)) * 16777619u;
+    }
+    return hash;
+}
+
+// FNV-1a hash of a data block
+uint32_t Helpers::hash_data(const uint8_t * data, const size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
 std::string Helpers::toUpper(std::string const & s) {
     std::string lc = s;
     std::transform(lc.begin(), lc.end(), lc.begin(), [](unsigned char c) { return std::toupper(c); });
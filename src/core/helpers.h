@@ -59,6 +59,8 @@ class Helpers {
     static std::string toUpper(std::string const & s);
     static std::string toLower(const char * s);
     static void        CharToUpperUTF8(char * c);
+    static uint32_t    hash_lower(const char * s);
+    static uint32_t    hash_data(const uint8_t * data, const size_t length);
 
     static void replace_char(char * str, char find, char replace);
 
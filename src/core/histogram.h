@@ -0,0 +1,119 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMSESP_HISTOGRAM_H
+#define EMSESP_HISTOGRAM_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace emsesp {
+
+// Fixed-bucket histogram that is always on. add() is a few compares and atomic increments,
+// so it can be called from the UART task while the main loop reads it.
+// The bounds are the upper limits of the buckets in ascending order (inclusive),
+// larger values are counted in one extra overflow bucket.
+class Histogram {
+  public:
+    static constexpr uint8_t MAX_BUCKETS = 12;
+
+    template <size_t N>
+    explicit Histogram(const uint32_t (&bounds)[N])
+        : bounds_(bounds)
+        , num_bounds_(N) {
+        static_assert(N > 0 && N < MAX_BUCKETS, "Histogram has too many bounds");
+    }
+    ~Histogram() = default;
+
+    Histogram(const Histogram &)             = delete;
+    Histogram & operator=(const Histogram &) = delete;
+
+    void add(const uint32_t value) {
+        uint8_t bucket = 0;
+        while (bucket < num_bounds_ && value > bounds_[bucket]) {
+            bucket++;
+        }
+        counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t max = max_.load(std::memory_order_relaxed);
+        while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint8_t buckets() const {
+        return num_bounds_ + 1;
+    }
+
+    // upper limit of a bucket, the overflow bucket has none
+    uint32_t bound(const uint8_t bucket) const {
+        return bucket < num_bounds_ ? bounds_[bucket] : UINT32_MAX;
+    }
+
+    uint32_t count(const uint8_t bucket) const {
+        return counts_[bucket].load(std::memory_order_relaxed);
+    }
+
+    uint32_t count() const {
+        uint32_t total = 0;
+        for (uint8_t i = 0; i <= num_bounds_; i++) {
+            total += count(i);
+        }
+        return total;
+    }
+
+    uint32_t max() const {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    // the upper limit of the bucket holding the given percentile, or the largest value if that is lower
+    // returns 0 if nothing was added yet
+    uint32_t percentile(const uint8_t percent) const {
+        uint32_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        uint32_t rank = (uint32_t)(((uint64_t)total * percent + 99) / 100);
+        uint32_t seen = 0;
+        uint8_t  i    = 0;
+        for (; i < num_bounds_; i++) {
+            seen += count(i);
+            if (seen >= rank) {
+                break;
+            }
+        }
+        return (i < num_bounds_ && bounds_[i] < max()) ? bounds_[i] : max();
+    }
+
+    void reset() {
+        for (auto & count : counts_) {
+            count.store(0, std::memory_order_relaxed);
+        }
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+  private:
+    const uint32_t *      bounds_;
+    const uint8_t         num_bounds_;
+    std::atomic<uint32_t> counts_[MAX_BUCKETS]{};
+    std::atomic<uint32_t> max_{0};
+};
+
+} // namespace emsesp
+
+#endif
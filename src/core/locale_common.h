@@ -43,6 +43,7 @@ MAKE_WORD(fetch)
 MAKE_WORD(restart)
 MAKE_WORD(format)
 MAKE_WORD(txpause)
+MAKE_WORD(capture)
 MAKE_WORD(raw)
 MAKE_WORD(watch)
 MAKE_WORD(syslog)
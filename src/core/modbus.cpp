@@ -386,7 +386,7 @@ ModbusMessage Modbus::handleWrite(const ModbusMessage & request) {
 
     JsonDocument output_doc;
     JsonObject   output      = output_doc.to<JsonObject>();
-    uint8_t      return_code = Command::process(path.c_str(), true, input, output); // modbus is always authenticated
+    uint8_t      return_code = Command::execute(path.c_str(), true, input, output); // modbus is always authenticated
 
     if (return_code != CommandRet::OK) {
         char error[100];
@@ -37,6 +37,9 @@ uint32_t    Mqtt::publish_time_water_;
 uint32_t    Mqtt::publish_time_sensor_;
 uint32_t    Mqtt::publish_time_other_;
 uint32_t    Mqtt::publish_time_heartbeat_;
+uint16_t    Mqtt::publish_flush_;
+TokenBucket Mqtt::rate_msgs_;
+TokenBucket Mqtt::rate_bytes_;
 bool        Mqtt::mqtt_enabled_;
 uint8_t     Mqtt::entity_format_;
 bool        Mqtt::ha_enabled_;
@@ -48,6 +51,7 @@ bool        Mqtt::publish_single_;
 bool        Mqtt::publish_single2cmd_;
 
 std::vector<Mqtt::MQTTSubFunction, AllocatorPSRAM<Mqtt::MQTTSubFunction>> Mqtt::mqtt_subfunctions_;
+std::unordered_multimap<uint32_t, uint16_t, std::hash<uint32_t>, std::equal_to<uint32_t>, AllocatorPSRAM<std::pair<const uint32_t, uint16_t>>> Mqtt::mqtt_subtopics_;
 
 uint32_t Mqtt::mqtt_publish_fails_ = 0;
 bool     Mqtt::connecting_         = false;
@@ -56,10 +60,16 @@ bool     Mqtt::ha_climate_reset_   = false;
 uint16_t Mqtt::queuecount_         = 0;
 uint8_t  Mqtt::connectcount_       = 0;
 uint32_t Mqtt::mqtt_message_id_    = 0;
+uint16_t Mqtt::backlog_            = 0;
+uint16_t Mqtt::backlog_max_size_   = MQTT_QUEUE_MAX_SIZE;
+uint32_t Mqtt::backlog_max_bytes_  = MQTT_BACKLOG_MAX_BYTES;
 char     will_topic_[Mqtt::MQTT_TOPIC_MAX_SIZE]; // because MQTT library keeps only char pointer
 
 std::string Mqtt::lastresponse_ = "";
 
+PublishQueue Mqtt::pending_[Mqtt::PRIORITY_COUNT];
+uint32_t     Mqtt::publish_sent_[Mqtt::PRIORITY_COUNT] = {};
+
 // Home Assistant specific
 // icons from https://materialdesignicons.com used with the UOMs (unit of measurements)
 // MAKE_WORD_CUSTOM(icondegrees, "mdi:coolant-temperature") // DeviceValueUOM::DEGREES
@@ -92,6 +102,7 @@ void Mqtt::subscribe(const uint8_t device_type, const std::string & topic, mqtt_
     // We store the original topic string without base
     // removed std::move(topic) in 3.7.0-dev.43
     mqtt_subfunctions_.emplace_back(device_type, topic, cb);
+    mqtt_subtopics_.emplace(subtopic_hash(topic), mqtt_subfunctions_.size() - 1);
 
     if (!enabled() || !connected()) {
         return;
@@ -101,6 +112,21 @@ void Mqtt::subscribe(const uint8_t device_type, const std::string & topic, mqtt_
     queue_subscribe_message(topic);
 }
 
+// hash of the full topic <base>/<topic>, as received in on_message
+uint32_t Mqtt::subtopic_hash(const std::string & topic) {
+    char full_topic[MQTT_TOPIC_MAX_SIZE];
+    snprintf(full_topic, sizeof(full_topic), "%s/%s", Mqtt::base().c_str(), topic.c_str());
+    return Helpers::hash_data((const uint8_t *)full_topic, strlen(full_topic));
+}
+
+// rebuild the index of the subscribed topics, when the base has changed
+void Mqtt::index_subtopics() {
+    mqtt_subtopics_.clear();
+    for (uint16_t i = 0; i < mqtt_subfunctions_.size(); i++) {
+        mqtt_subtopics_.emplace(subtopic_hash(mqtt_subfunctions_[i].topic_.c_str()), i);
+    }
+}
+
 // subscribe without storing to subfunctions
 void Mqtt::subscribe(const std::string & topic) {
     // add to MQTT queue as a subscribe operation
@@ -126,7 +152,7 @@ void Mqtt::loop() {
         return;
     }
 
-    queuecount_ = mqttClient_->queueSize();
+    flush_publishes();
 
     uint32_t currentMillis = uuid::get_uptime();
 
@@ -141,8 +167,8 @@ void Mqtt::loop() {
         EMSESP::publish_sensor_values(false);
     }
 
-    // wait for empty queue before sending scheduled device messages
-    if (queuecount_ > 0) {
+    // wait until the device publishes are sent before sending scheduled device messages, HA discovery goes on in the background
+    if (publish_queued(PRIORITY_DEVICE) > 0) {
         return;
     }
 
@@ -190,6 +216,16 @@ void Mqtt::show_mqtt(uuid::console::Shell & shell) {
 
     shell.printfln("MQTT publish errors: %lu", mqtt_publish_fails_);
     shell.printfln("MQTT queue: %d", queuecount_);
+    shell.printfln("MQTT publish rate: %d msgs/s, %d bytes/s (0 is unlimited)", rate_msgs_.rate(), rate_bytes_.rate());
+    const char * const priority_names[PRIORITY_COUNT] = {"response", "single value", "device", "HA discovery"};
+    for (uint8_t priority = 0; priority < PRIORITY_COUNT; priority++) {
+        shell.printfln("MQTT %s publishes: %lu sent, %d pending, %lu coalesced",
+                       priority_names[priority],
+                       publish_sent_[priority],
+                       pending_[priority].size(),
+                       pending_[priority].coalesced());
+    }
+    shell.printfln("MQTT publishes from while offline: %d pending", backlog_);
     shell.println();
 
     // show subscriptions
@@ -215,14 +251,39 @@ void Mqtt::incoming(const char * topic, const char * payload) {
 // topic is the full path
 // payload is json or a single string and converted to a json with key 'value'
 void Mqtt::on_message(const char * topic, const uint8_t * payload, size_t len) {
+    // with PSRAM the client runs in its own task, the commands are run by the main loop
+    // waits for room in the command queue, which holds back the MQTT task
+    if (!Command::in_loop()) {
+        cmd_run_function_p run = [topic_s = std::string(topic), message_s = std::string((const char *)payload, len)]() {
+            on_command(topic_s.c_str(), (const uint8_t *)message_s.data(), message_s.size());
+        };
+        for (uint16_t wait = 0; !Command::post(run); wait++) {
+            if (wait == COMMAND_QUEUE_TIMEOUT) {
+                LOG_ERROR("MQTT command %s dropped, command queue full", topic);
+                return;
+            }
+            delay(1);
+        }
+        return;
+    }
+
+    on_command(topic, payload, len);
+}
+
+// handle an incoming message, in the main loop
+void Mqtt::on_command(const char * topic, const uint8_t * payload, size_t len) {
     // the payload is not terminated
-    // convert payload to a null-terminated char string
+    // convert payload to a null-terminated char string, on the stack when it's short
     // see https://www.emelis.net/espMqttClient/#code-samples
-    // fix variable-length arrays (VLAs) "char message[len + 1]" as they are not standard C++; they're a Clang/GCC extension.
-    std::vector<char> message_buffer(len + 1);
-    memcpy(message_buffer.data(), payload, len);
-    message_buffer[len] = '\0';
-    char * message      = message_buffer.data();
+    char              message_short[64];
+    std::vector<char> message_buffer;
+    char *            message = message_short;
+    if (len >= sizeof(message_short)) {
+        message_buffer.resize(len + 1);
+        message = message_buffer.data();
+    }
+    memcpy(message, payload, len);
+    message[len] = '\0';
 
 #if defined(EMSESP_DEBUG)
     if (len) {
@@ -232,7 +293,8 @@ void Mqtt::on_message(const char * topic, const uint8_t * payload, size_t len) {
     }
 #endif
     // remove HA topics if we don't use discovery
-    if (strncmp(topic, discovery_prefix().c_str(), discovery_prefix().size()) == 0) {
+    size_t prefix_len = discovery_prefix_.size();
+    if (prefix_len && strncmp(topic, discovery_prefix_.c_str(), prefix_len) == 0 && topic[prefix_len] == '/') {
         if (!ha_enabled_ && len) { // don't ping pong the empty message
             queue_publish_message(topic, "", true);
             LOG_DEBUG("Remove topic %s", topic);
@@ -240,41 +302,46 @@ void Mqtt::on_message(const char * topic, const uint8_t * payload, size_t len) {
         return;
     }
 
+    // the path after <base>/, or nullptr if it's not one of ours
+    size_t       base_len = mqtt_base_.size();
+    const char * path     = (strncmp(topic, mqtt_base_.c_str(), base_len) == 0 && topic[base_len] == '/') ? topic + base_len + 1 : nullptr;
+
     // check first against any of our subscribed topics
-    for (const auto & mf : mqtt_subfunctions_) {
-        // add the base back
-        char full_topic[MQTT_TOPIC_MAX_SIZE];
-        snprintf(full_topic, sizeof(full_topic), "%s/%s", Mqtt::base().c_str(), mf.topic_.c_str());
-
-        if ((!strcmp(topic, full_topic)) && (mf.mqtt_subfunction_)) {
-            if (!(mf.mqtt_subfunction_)(message)) {
-                LOG_ERROR("error: invalid payload %s for this topic %s", message, topic);
-                Mqtt::queue_publish("response", "error: invalid data");
+    if (path) {
+        auto range = mqtt_subtopics_.equal_range(Helpers::hash_data((const uint8_t *)topic, strlen(topic)));
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto & mf = mqtt_subfunctions_[it->second];
+            if ((mf.topic_ == path) && (mf.mqtt_subfunction_)) {
+                if (!(mf.mqtt_subfunction_)(message)) {
+                    LOG_ERROR("error: invalid payload %s for this topic %s", message, topic);
+                    Mqtt::queue_publish("response", "error: invalid data");
+                }
+                return;
             }
-            return;
         }
     }
 
     JsonDocument input_doc;
     JsonDocument output_doc;
     JsonObject   input;
-    JsonObject   output;
+    JsonObject   output = output_doc.to<JsonObject>();
+    uint8_t      return_code;
 
-    // convert payload into a json doc
+    // a plain value to <base>/<device>/<cmd> or <base>/<device>/<hc>/<cmd> goes straight to the command
+    // anything else is converted into a json doc
     // if the payload doesn't not contain the key 'value' or 'data', treat the whole payload as the 'value'
-    if (len != 0) {
-        DeserializationError error = deserializeJson(input_doc, (const char *)message);
-        if (((!input_doc["value"].is<JsonVariantConst>()) && (!input_doc["data"].is<JsonVariantConst>())) || error) {
-            input_doc.clear();
-            input_doc["value"] = (const char *)message; // always a string
+    if (!len || !path || !Command::process_value(path, message, true, output, return_code)) {
+        if (len != 0) {
+            DeserializationError error = deserializeJson(input_doc, (const char *)message);
+            if (((!input_doc["value"].is<JsonVariantConst>()) && (!input_doc["data"].is<JsonVariantConst>())) || error) {
+                input_doc.clear();
+                input_doc["value"] = (const char *)message; // always a string
+            }
         }
+        input       = input_doc.as<JsonObject>();
+        return_code = Command::process(topic, true, input, output); // mqtt is always authenticated
     }
 
-    // parse and call the command
-    input               = input_doc.as<JsonObject>();
-    output              = output_doc.to<JsonObject>();
-    uint8_t return_code = Command::process(topic, true, input, output); // mqtt is always authenticated
-
     if (return_code != CommandRet::OK) {
         char error[100];
         if (output.size()) {
@@ -353,10 +420,23 @@ void Mqtt::load_settings() {
         publish_time_other_      = mqttSettings.publish_time_other * 1000;
         publish_time_sensor_     = mqttSettings.publish_time_sensor * 1000;
         publish_time_heartbeat_  = mqttSettings.publish_time_heartbeat * 1000;
+        publish_flush_           = mqttSettings.publish_flush; // already in milliseconds
+        rate_msgs_.rate(mqttSettings.publish_rate_msgs);
+        rate_bytes_.rate(mqttSettings.publish_rate_bytes);
     });
 
     // create unique ID from the mqtt base replacing all / with underscores, in case it's a path
     basename(mqtt_base_);
+
+    index_subtopics();
+
+    // nothing is kept for a reconnect if MQTT is disabled
+    if (!mqtt_enabled_) {
+        for (auto & pending : pending_) {
+            pending.clear();
+        }
+        backlog_ = 0;
+    }
 }
 
 // start mqtt
@@ -376,6 +456,14 @@ void Mqtt::start() {
     }
     initialized_ = true;
 
+    // with PSRAM keep more topics while offline, that's the limit for all priorities together
+    // without it the backlog is in the heap and also limited by its size
+    backlog_max_size_  = EMSESP::system_.PSram() ? MQTT_BACKLOG_MAX_SIZE : MQTT_QUEUE_MAX_SIZE;
+    backlog_max_bytes_ = EMSESP::system_.PSram() ? 0 : MQTT_BACKLOG_MAX_BYTES;
+    for (auto & pending : pending_) {
+        pending.max_size(backlog_max_size_);
+    }
+
     // add the 'publish' command ('call system publish' in console or via API)
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(publish), System::command_publish, FL_(publish_cmd));
 
@@ -416,6 +504,56 @@ void Mqtt::set_publish_time_heartbeat(uint16_t publish_time) {
     publish_time_heartbeat_ = publish_time * 1000; // convert to milliseconds
 }
 
+void Mqtt::set_publish_flush(uint16_t publish_flush) {
+    publish_flush_ = publish_flush;
+}
+
+void Mqtt::set_publish_rate(uint16_t msgs, uint16_t bytes) {
+    rate_msgs_.rate(msgs);
+    rate_bytes_.rate(bytes);
+}
+
+// publishes of this priority or higher still pending, which a new publish of that priority waits for
+uint32_t Mqtt::publish_queued(const uint8_t priority) {
+    if (!connected()) {
+        return 0;
+    }
+    uint32_t queued = 0;
+    for (uint8_t p = 0; p <= priority && p < PRIORITY_COUNT; p++) {
+        queued += pending_[p].size();
+    }
+    return queued;
+}
+
+// # topics that can still be added at this priority, the HA configs are only created when there is room
+size_t Mqtt::publish_room(const uint8_t priority) {
+    return priority < PRIORITY_COUNT ? pending_[priority].room() : 0;
+}
+
+uint32_t Mqtt::publish_pending() {
+    uint32_t pending = 0;
+    for (const auto & queue : pending_) {
+        pending += queue.size();
+    }
+    return pending;
+}
+
+uint32_t Mqtt::publish_pending_bytes() {
+    uint32_t bytes = 0;
+    for (const auto & queue : pending_) {
+        bytes += queue.bytes();
+    }
+    return bytes;
+}
+
+uint32_t Mqtt::publish_coalesced() {
+    uint32_t coalesced = 0;
+    for (const auto & queue : pending_) {
+        coalesced += queue.coalesced();
+    }
+    return coalesced;
+}
+
 bool Mqtt::get_publish_onchange(uint8_t device_type) {
     if (publish_single_ && !ha_enabled_) {
         return false;
@@ -485,6 +623,12 @@ void Mqtt::on_connect() {
     connecting_ = true;
     queuecount_ = mqttClient_->queueSize();
 
+    // send what was kept while offline first, paced
+    backlog_ = publish_pending();
+    if (backlog_) {
+        LOG_INFO("Publishing %d messages from while offline", backlog_);
+    }
+
     load_settings(); // reload MQTT settings - in case they have changes
 
     if (ha_enabled_) {
@@ -590,24 +734,56 @@ void Mqtt::ha_status() {
     publish_system_ha_sensor_config(DeviceValueType::STRING, "Version", "version", DeviceValueUOM::NONE);
 }
 
-// add sub or pub task to the queue.
-// the base is not included in the topic
+// add sub or pub task to the queue, payload is a string
 bool Mqtt::queue_message(const uint8_t operation, const std::string & topic, const std::string & payload, const bool retain) {
+    return queue_message(
+        operation,
+        topic,
+        payload.size(),
+        [&payload](uint8_t * data, size_t length) {
+            memcpy(data, payload.data(), length);
+            return length;
+        },
+        retain);
+}
+
+// add sub or pub task to the queue, the payload of length bytes is filled in by writer
+// publishes wait in pending_ until the next flush, subscribes go straight to the MQTT client
+// the response topic and HA discovery topics have their own priority, others are given by the caller
+// the base is not included in the topic
+bool Mqtt::queue_message(const uint8_t                operation,
+                         const std::string &          topic,
+                         const size_t                 length,
+                         const PublishQueue::Writer & writer,
+                         const bool                   retain,
+                         uint8_t                      priority) {
     if (topic == "response" && operation == Operation::PUBLISH) {
-        lastresponse_ = payload;
+        priority = PRIORITY_RESPONSE;
+        lastresponse_.resize(length);
+        lastresponse_.resize(writer((uint8_t *)&lastresponse_[0], length));
         if (!send_response_) {
             return true;
         }
     }
 
-    if (!mqtt_enabled_ || topic.empty() || !connected()) {
+    if (!mqtt_enabled_ || topic.empty()) {
         return false; // quit, not using MQTT
     }
 
+    // while disconnected only the latest publish per topic is kept for the reconnect
+    // subscribes are done again on connect and the HA configs created again
+    bool offline = !connected();
+    if (offline && (operation != Operation::PUBLISH || (!discovery_prefix_.empty() && topic.find(discovery_prefix_) == 0))) {
+        return false;
+    }
+
 // check free mem
 #ifndef EMSESP_STANDALONE
     // if (ESP.getFreeHeap() < 60 * 1024 || ESP.getMaxAllocHeap() < 40 * 1024) {
     if (heap_caps_get_free_size(MALLOC_CAP_8BIT) < 60 * 1024) { // checks free Heap+PSRAM
+        if (offline) {
+            return false; // the backlog stops growing, nothing failed
+        }
         if (operation == Operation::PUBLISH) {
             mqtt_message_id_++;
             mqtt_publish_fails_++;
@@ -615,12 +791,8 @@ bool Mqtt::queue_message(const uint8_t operation, const std::string & topic, con
         LOG_WARNING("%s failed: low memory", operation == Operation::PUBLISH ? "Publish" : operation == Operation::SUBSCRIBE ? "Subscribe" : "Unsubscribe");
         return false; // quit
     }
-    if (queuecount_ >= MQTT_QUEUE_MAX_SIZE) {
-        if (operation == Operation::PUBLISH) {
-            mqtt_message_id_++;
-            mqtt_publish_fails_++;
-        }
-        LOG_WARNING("%s failed: queue full", operation == Operation::PUBLISH ? "Publish" : operation == Operation::SUBSCRIBE ? "Subscribe" : "Unsubscribe");
+    if (operation != Operation::PUBLISH && queuecount_ >= MQTT_QUEUE_MAX_SIZE) {
+        LOG_WARNING("%s failed: queue full", operation == Operation::SUBSCRIBE ? "Subscribe" : "Unsubscribe");
         return false; // quit
     }
 #endif
@@ -630,14 +802,37 @@ bool Mqtt::queue_message(const uint8_t operation, const std::string & topic, con
 
     if (topic.find(discovery_prefix_) == 0) {
         strlcpy(fulltopic, topic.c_str(), sizeof(fulltopic)); // leave discovery topic as it is
+        if (!discovery_prefix_.empty()) {
+            priority = PRIORITY_HA;
+        }
     } else {
         // it's not a discovery topic, added the mqtt base to the topic path
         snprintf(fulltopic, sizeof(fulltopic), "%s/%s", Mqtt::base().c_str(), topic.c_str());
     }
 
     if (operation == Operation::PUBLISH) {
-        packet_id = mqttClient_->publish(fulltopic, mqtt_qos_, retain, payload.c_str());
+        // nothing to coalesce in a HA config, if nothing else is waiting and the client has room it goes straight into the packet
+        if (offline || priority != PRIORITY_HA || publish_pending() || queuecount_ >= MQTT_CLIENT_QUEUE || !rate_msgs_.available()
+            || !rate_bytes_.available()) {
+            // a newer payload replaces the one still waiting for the same topic
+            bool add = !offline || (publish_pending() < backlog_max_size_ && (!backlog_max_bytes_ || publish_pending_bytes() < backlog_max_bytes_));
+            if (!pending_[priority].push(fulltopic, length, writer, retain, add)) {
+                if (offline) {
+                    return false; // backlog is full, not counted as a failed publish
+                }
+                mqtt_message_id_++;
+                mqtt_publish_fails_++;
+                LOG_WARNING("Publish failed: queue full");
+                return false;
+            }
+            return true;
+        }
+        packet_id = mqttClient_->publish(fulltopic, mqtt_qos_, retain, length, writer);
         mqtt_message_id_++;
+        queuecount_++;
+        publish_sent_[priority]++;
+        rate_msgs_.take(1);
+        rate_bytes_.take(strlen(fulltopic) + length);
         LOG_DEBUG("Publishing topic '%s', pid %d", fulltopic, packet_id);
     } else if (operation == Operation::SUBSCRIBE) {
         packet_id = mqttClient_->subscribe(fulltopic, mqtt_qos_);
@@ -655,6 +850,47 @@ bool Mqtt::queue_message(const uint8_t operation, const std::string & topic, con
     return (packet_id != 0);
 }
 
+// hand the waiting publishes to the MQTT client, every publish_flush_ ms, highest priority first
+// the client only gets MQTT_CLIENT_QUEUE ahead, so a response never waits behind a long run of HA configs
+// only as many as the rate limits allow, a lower priority gets what is left
+// whatever isn't sent stays pending and can still be replaced by a newer value
+// the backlog kept while offline is sent the same way, ahead of anything of the same priority published after the reconnect
+void Mqtt::flush_publishes() {
+    queuecount_ = mqttClient_->queueSize();
+
+    uint32_t currentMillis = uuid::get_uptime();
+    if (currentMillis - last_publish_flush_ < publish_flush_) {
+        return;
+    }
+    last_publish_flush_ = currentMillis;
+    rate_msgs_.refill(currentMillis);
+    rate_bytes_.refill(currentMillis);
+
+    PublishQueue::Message message;
+    for (uint8_t priority = 0; priority < PRIORITY_COUNT; priority++) {
+        while (queuecount_ < MQTT_CLIENT_QUEUE && rate_msgs_.available() && rate_bytes_.available() && pending_[priority].pop(message)) {
+            if (backlog_) {
+                backlog_--;
+            }
+            uint16_t packet_id =
+                mqttClient_->publish(message.topic_.c_str(), mqtt_qos_, message.retain_, (const uint8_t *)message.payload_.data(), message.payload_.size());
+            mqtt_message_id_++;
+            publish_sent_[priority]++;
+            rate_msgs_.take(1);
+            rate_bytes_.take(message.topic_.size() + message.payload_.size());
+            if (packet_id) {
+                LOG_DEBUG("Publishing topic '%s', pid %d", message.topic_.c_str(), packet_id);
+            } else {
+#ifndef EMSESP_STANDALONE
+                LOG_WARNING("Publish failed: %s", message.topic_.c_str());
+                mqtt_publish_fails_++;
+#endif
+            }
+            queuecount_ = mqttClient_->queueSize();
+        }
+    }
+}
+
 // add MQTT subscribe message to queue
 void Mqtt::queue_subscribe_message(const std::string & topic) {
     queue_message(Operation::SUBSCRIBE, topic, "", false); // no payload, no retain
@@ -714,13 +950,15 @@ bool Mqtt::queue_publish_retain(const char * topic, const char * payload) {
     return queue_publish_message(topic, payload, true);
 }
 
-// converts json payload to string, uses any retain flag
+// serializes a json payload straight into the buffer of the pending publish or the MQTT packet
+static PublishQueue::Writer json_writer(const JsonObjectConst payload) {
+    return [payload](uint8_t * data, size_t length) { return serializeJson(payload, data, length); };
+}
+
+// publish json doc, only if its not empty, uses any retain flag
 bool Mqtt::queue_publish(const char * topic, const JsonObjectConst payload, const bool retain) {
     if (payload.size()) {
-        std::string payload_text;
-        payload_text.reserve(measureJson(payload) + 1);
-        serializeJson(payload, payload_text); // convert json to string
-        return queue_publish_message(topic, payload_text, retain);
+        return queue_message(Operation::PUBLISH, topic, measureJson(payload), json_writer(payload), retain, PRIORITY_DEVICE);
     }
     return false;
 }
@@ -740,11 +978,7 @@ bool Mqtt::queue_ha(const char * topic, const JsonObjectConst payload) {
         return false;
     }
 
-    std::string payload_text;
-    payload_text.reserve(measureJson(payload) + 1);
-    serializeJson(payload, payload_text); // convert json to string
-
-    return queue_publish_message(Mqtt::discovery_prefix() + topic, payload_text, true); // with retain true
+    return queue_message(Operation::PUBLISH, Mqtt::discovery_prefix() + topic, measureJson(payload), json_writer(payload), true); // with retain true
 }
 
 // create's a ha sensor config topic from a device value object (dev)
@@ -26,6 +26,7 @@
 #include "console.h"
 #include "command.h"
 #include "emsdevicevalue.h"
+#include "publishqueue.h"
 #include <esp32-psram.h>
 
 using uuid::console::Shell;
@@ -56,13 +57,20 @@ class Mqtt {
     void set_publish_time_other(uint16_t publish_time);
     void set_publish_time_sensor(uint16_t publish_time);
     void set_publish_time_heartbeat(uint16_t publish_time);
+    void set_publish_flush(uint16_t publish_flush);
+    void set_publish_rate(uint16_t msgs, uint16_t bytes);
     bool get_publish_onchange(uint8_t device_type);
 
     enum Operation : uint8_t { PUBLISH, SUBSCRIBE, UNSUBSCRIBE };
     enum NestedFormat : uint8_t { NESTED = 1, SINGLE };
+    // publishes are sent in this order: command responses, single values, device publishes, HA discovery
+    enum Priority : uint8_t { PRIORITY_RESPONSE = 0, PRIORITY_SINGLE, PRIORITY_DEVICE, PRIORITY_HA, PRIORITY_COUNT };
 
-    static constexpr uint8_t  MQTT_TOPIC_MAX_SIZE = 128; // fixed, not a user setting anymore
-    static constexpr uint16_t MQTT_QUEUE_MAX_SIZE = 300;
+    static constexpr uint8_t  MQTT_TOPIC_MAX_SIZE    = 128;       // fixed, not a user setting anymore
+    static constexpr uint16_t MQTT_QUEUE_MAX_SIZE    = 300;
+    static constexpr uint16_t MQTT_BACKLOG_MAX_SIZE  = 1000;      // topics kept while offline, with PSRAM
+    static constexpr uint32_t MQTT_BACKLOG_MAX_BYTES = 16 * 1024; // bytes kept while offline, without PSRAM
+    static constexpr uint16_t MQTT_CLIENT_QUEUE      = 20;        // publishes handed to the client ahead, the rest waits in priority order
 
     static void on_connect();
     static void on_disconnect(espMqttClientTypes::DisconnectReason reason);
@@ -181,10 +189,17 @@ class Mqtt {
         return mqtt_publish_fails_;
     }
 
+    // what is waiting to be sent, the backlog kept while offline only counts when connected
     static uint32_t publish_queued() {
-        return queuecount_;
+        return connected() ? queuecount_ + publish_pending() : 0;
     }
 
+    static uint32_t publish_queued(const uint8_t priority);
+    static size_t   publish_room(const uint8_t priority);
+    static uint32_t publish_pending();
+    static uint32_t publish_pending_bytes();
+    static uint32_t publish_coalesced();
+
     static uint8_t connect_count() {
         return connectcount_;
     }
@@ -280,11 +295,20 @@ class Mqtt {
     static uint32_t     mqtt_message_id_;
 
     static bool queue_message(const uint8_t operation, const std::string & topic, const std::string & payload, const bool retain);
+    static bool queue_message(const uint8_t                operation,
+                              const std::string &          topic,
+                              const size_t                 length,
+                              const PublishQueue::Writer & writer,
+                              const bool                   retain,
+                              const uint8_t                priority = PRIORITY_SINGLE);
     static bool queue_publish_message(const std::string & topic, const std::string & payload, const bool retain);
     static void queue_subscribe_message(const std::string & topic);
     static void queue_unsubscribe_message(const std::string & topic);
 
+    static void on_command(const char * topic, const uint8_t * payload, size_t len);
+
     void on_publish(uint16_t packetId) const;
+    void flush_publishes();
 
     // function handlers for MQTT subscriptions
     struct MQTTSubFunction {
@@ -301,6 +325,11 @@ class Mqtt {
     };
 
     static std::vector<MQTTSubFunction, AllocatorPSRAM<MQTTSubFunction>> mqtt_subfunctions_; // list of mqtt subscribe callbacks for all devices
+    static std::unordered_multimap<uint32_t, uint16_t, std::hash<uint32_t>, std::equal_to<uint32_t>, AllocatorPSRAM<std::pair<const uint32_t, uint16_t>>>
+        mqtt_subtopics_; // hash of the full topic -> index in mqtt_subfunctions_
+
+    static uint32_t subtopic_hash(const std::string & topic);
+    static void     index_subtopics();
 
     uint32_t last_publish_boiler_     = 0;
     uint32_t last_publish_thermostat_ = 0;
@@ -310,14 +339,22 @@ class Mqtt {
     uint32_t last_publish_other_      = 0;
     uint32_t last_publish_sensor_     = 0;
     uint32_t last_publish_heartbeat_  = 0;
+    uint32_t last_publish_flush_      = 0;
     // uint32_t last_publish_queue_      = 0;
 
-    static bool     connecting_;
-    static bool     initialized_;
-    static uint32_t mqtt_publish_fails_;
-    static uint16_t queuecount_;
-    static uint8_t  connectcount_;
-    static bool     ha_climate_reset_;
+    static bool         connecting_;
+    static bool         initialized_;
+    static uint32_t     mqtt_publish_fails_;
+    static uint16_t     queuecount_;
+    static PublishQueue pending_[PRIORITY_COUNT];      // publishes not yet handed to the MQTT client, also kept while offline
+    static uint32_t     publish_sent_[PRIORITY_COUNT]; // # handed to the MQTT client
+    static uint16_t     backlog_;                      // # publishes from while offline still pending
+    static uint16_t     backlog_max_size_;             // # topics kept while offline, of all priorities
+    static uint32_t     backlog_max_bytes_;            // bytes kept while offline, 0 is no limit
+    static TokenBucket  rate_msgs_;
+    static TokenBucket  rate_bytes_;
+    static uint8_t      connectcount_;
+    static bool         ha_climate_reset_;
 
     static std::string lastresponse_;
 
@@ -335,6 +372,7 @@ class Mqtt {
     static uint32_t    publish_time_other_;
     static uint32_t    publish_time_sensor_;
     static uint32_t    publish_time_heartbeat_;
+    static uint16_t    publish_flush_; // in ms
     static bool        mqtt_enabled_;
     static bool        ha_enabled_;
     static uint8_t     nested_format_;
@@ -0,0 +1,102 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "publishqueue.h"
+#include "helpers.h"
+
+namespace emsesp {
+
+bool PublishQueue::push(const char * topic, const char * payload, const bool retain, const bool add) {
+    return push(
+        topic,
+        strlen(payload),
+        [payload](uint8_t * data, size_t length) {
+            memcpy(data, payload, length);
+            return length;
+        },
+        retain,
+        add);
+}
+
+// the payload is written straight into its place in the queue, a waiting one for the same topic is overwritten
+bool PublishQueue::push(const char * topic, const size_t length, const Writer & writer, const bool retain, const bool add) {
+    uint32_t                    hash = Helpers::hash_data((const uint8_t *)topic, strlen(topic));
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Message * message = nullptr;
+    auto      range   = index_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->topic_ == topic) {
+            message = &*it->second;
+            coalesced_++;
+            break;
+        }
+    }
+
+    if (message == nullptr) {
+        if (!add || messages_.size() >= max_size_) {
+            return false;
+        }
+        messages_.push_back({topic, stringPSRAM(), retain});
+        index_.emplace(hash, std::prev(messages_.end()));
+        message = &messages_.back();
+        bytes_ += message->topic_.size();
+    }
+
+    bytes_ -= message->payload_.size();
+    message->retain_ = retain;
+    message->payload_.resize(length);
+    message->payload_.resize(writer((uint8_t *)&message->payload_[0], length));
+    bytes_ += message->payload_.size();
+    return true;
+}
+
+bool PublishQueue::pop(Message & message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (messages_.empty()) {
+        return false;
+    }
+
+    auto front = messages_.begin();
+    auto range = index_.equal_range(Helpers::hash_data((const uint8_t *)front->topic_.c_str(), front->topic_.size()));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == front) {
+            index_.erase(it);
+            break;
+        }
+    }
+
+    bytes_ -= front->topic_.size() + front->payload_.size();
+    message = std::move(*front);
+    messages_.pop_front();
+    return true;
+}
+
+void PublishQueue::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    messages_.clear();
+    bytes_ = 0;
+}
+
+size_t PublishQueue::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return messages_.size();
+}
+
+} // namespace emsesp
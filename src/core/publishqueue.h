@@ -0,0 +1,139 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMSESP_PUBLISHQUEUE_H
+#define EMSESP_PUBLISHQUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <esp32-psram.h>
+
+namespace emsesp {
+
+// MQTT publishes waiting to be handed to the MQTT client, at most one per topic.
+// A newer payload for a topic that is still waiting replaces the old one and keeps its place (last value wins),
+// so a value changing faster than the broker link takes one slot instead of one per change.
+// Publishes are added from the main loop and the MQTT task, so all access is locked.
+class PublishQueue {
+  public:
+    struct Message {
+        stringPSRAM topic_; // full topic, including the base
+        stringPSRAM payload_;
+        bool        retain_;
+    };
+
+    // fills the payload of exactly length bytes in place, returns the bytes written
+    using Writer = std::function<size_t(uint8_t * data, size_t length)>;
+
+    explicit PublishQueue(const size_t max_size = 0)
+        : max_size_(max_size) {
+    }
+
+    // returns false if the topic is not waiting yet and the queue is full, or add is false
+    bool push(const char * topic, const char * payload, const bool retain, const bool add = true);
+    bool push(const char * topic, const size_t length, const Writer & writer, const bool retain, const bool add = true);
+
+    // moves the oldest publish out, returns false if the queue is empty
+    bool pop(Message & message);
+
+    void   clear();
+    size_t size() const;
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    void max_size(const size_t max_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_size_ = max_size;
+    }
+
+    // # topics that can still be added
+    size_t room() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return messages_.size() < max_size_ ? max_size_ - messages_.size() : 0;
+    }
+
+    // bytes of topic and payload waiting
+    size_t bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+
+    // # publishes replaced by a newer payload before they were sent
+    uint32_t coalesced() const {
+        return coalesced_;
+    }
+
+  private:
+    using MessageList = std::list<Message, AllocatorPSRAM<Message>>;
+
+    mutable std::mutex mutex_;
+    MessageList        messages_;
+    std::unordered_multimap<uint32_t, MessageList::iterator, std::hash<uint32_t>, std::equal_to<uint32_t>, AllocatorPSRAM<std::pair<const uint32_t, MessageList::iterator>>>
+             index_; // topic hash -> waiting publish
+    size_t   max_size_;
+    size_t   bytes_     = 0;
+    uint32_t coalesced_ = 0;
+};
+
+// Limits something to rate per second, with bursts of up to one second.
+// Tokens are kept in 1/1000 to not lose the fractions of short intervals. A rate of 0 is unlimited.
+// It may go into debt for one large item, so an item bigger than a second's worth still gets through.
+class TokenBucket {
+  public:
+    void rate(const uint16_t rate) {
+        rate_   = rate;
+        tokens_ = (int32_t)rate * 1000;
+    }
+
+    uint16_t rate() const {
+        return rate_;
+    }
+
+    void refill(const uint32_t now_ms) {
+        uint32_t elapsed = std::min(now_ms - last_ms_, (uint32_t)1000);
+        last_ms_         = now_ms;
+        tokens_          = std::min(tokens_ + (int32_t)(elapsed * rate_), (int32_t)rate_ * 1000);
+    }
+
+    bool available() const {
+        return !rate_ || tokens_ > 0;
+    }
+
+    void take(const uint32_t amount) {
+        if (rate_) {
+            tokens_ -= (int32_t)amount * 1000;
+        }
+    }
+
+  private:
+    uint16_t rate_    = 0;
+    int32_t  tokens_  = 0;
+    uint32_t last_ms_ = 0;
+};
+
+} // namespace emsesp
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * EMS-ESP - https://github.com/emsesp/EMS-ESP
+ * Copyright 2020-2025  emsesp.org - proddy, MichaelDvP
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMSESP_RINGBUFFER_H
+#define EMSESP_RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace emsesp {
+
+// Fixed-capacity lock-free ring for exactly one producer and one consumer thread/task.
+// The storage is part of the object, so pushing and popping never allocates.
+// The producer fills a slot in place with write_slot() and publishes it with push(),
+// the consumer reads it in place with front() and releases it with pop().
+// N must be a power of 2. head_ is only written by the producer, tail_ only by the consumer.
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert(N && ((N & (N - 1)) == 0), "RingBuffer size must be a power of 2");
+
+  public:
+    RingBuffer()  = default;
+    ~RingBuffer() = default;
+
+    RingBuffer(const RingBuffer &)             = delete;
+    RingBuffer & operator=(const RingBuffer &) = delete;
+
+    // producer: returns the next free slot, or nullptr if the ring is full
+    T * write_slot() {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if ((head - tail_.load(std::memory_order_acquire)) >= N) {
+            return nullptr;
+        }
+        return &buffer_[head & (N - 1)];
+    }
+
+    // producer: publish the slot returned by write_slot()
+    void push() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // consumer: returns the oldest slot, or nullptr if the ring is empty
+    const T * front() const {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &buffer_[tail & (N - 1)];
+    }
+
+    // consumer: release the slot returned by front()
+    void pop() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // consumer: the n-th pending slot, only valid for n < size()
+    const T & peek(size_t n) const {
+        return buffer_[(tail_.load(std::memory_order_relaxed) + n) & (N - 1)];
+    }
+
+    // number of slots waiting to be consumed. A snapshot when called from the other side
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+  private:
+    std::atomic<uint32_t> head_{0}; // next slot to write, free running
+    std::atomic<uint32_t> tail_{0}; // next slot to read, free running
+    T                     buffer_[N];
+};
+
+// Fixed-capacity lock-free queue for any number of producer threads/tasks and one consumer.
+// Producers claim a slot by advancing head_, each slot carries a sequence number telling
+// whether it is free for the producer of that lap or filled for the consumer.
+// N must be a power of 2. tail_ is only written by the consumer.
+template <typename T, size_t N>
+class MpscRingBuffer {
+    static_assert(N && ((N & (N - 1)) == 0), "MpscRingBuffer size must be a power of 2");
+
+  public:
+    MpscRingBuffer() {
+        for (uint32_t i = 0; i < N; i++) {
+            slots_[i].seq_.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~MpscRingBuffer() = default;
+
+    MpscRingBuffer(const MpscRingBuffer &)             = delete;
+    MpscRingBuffer & operator=(const MpscRingBuffer &) = delete;
+
+    // producers: move the item into the queue, returns false if the queue is full
+    bool push(T && item) {
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+        Slot *   slot;
+        while (true) {
+            slot         = &slots_[pos & (N - 1)];
+            int32_t diff = (int32_t)(slot->seq_.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // the consumer has not released this slot yet
+            } else {
+                pos = head_.load(std::memory_order_relaxed); // another producer took it
+            }
+        }
+        slot->item_ = std::move(item);
+        slot->seq_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer: move the oldest item out, returns false if the queue is empty
+    bool pop(T & item) {
+        uint32_t pos  = tail_.load(std::memory_order_relaxed);
+        Slot &   slot = slots_[pos & (N - 1)];
+        if ((int32_t)(slot.seq_.load(std::memory_order_acquire) - (pos + 1)) < 0) {
+            return false;
+        }
+        item = std::move(slot.item_);
+        slot.seq_.store(pos + N, std::memory_order_release);
+        tail_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // number of claimed slots, a snapshot
+    size_t size() const {
+        return head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint32_t> seq_;
+        T                     item_;
+    };
+    std::atomic<uint32_t> head_{0}; // next slot to claim, free running
+    std::atomic<uint32_t> tail_{0}; // next slot to read, free running
+    Slot                  slots_[N];
+};
+
+} // namespace emsesp
+
+#endif
@@ -24,6 +24,9 @@
 
 namespace emsesp {
 
+// marks an entity reference in the expression given to exprToTokens(), see Expression::compile()
+static constexpr char EXPR_REFERENCE = '\x01';
+
 // find tokens - optimized to reduce string allocations
 std::deque<Token> exprToTokens(const std::string & expr) {
     std::deque<Token> tokens;
@@ -116,6 +119,8 @@ std::deque<Token> exprToTokens(const std::string & expr) {
             if (*p == '\0') {
                 --p;
             }
+        } else if (*p == EXPR_REFERENCE) {
+            tokens.emplace_back(Token::Type::Reference, "", -3);
         } else if (isdigit(*p)) {
             const auto * b = p;
             while (isdigit(*p) || *p == '.') {
@@ -242,6 +247,7 @@ std::deque<Token> shuntingYard(const std::deque<Token> & tokens) {
         switch (token.type) {
         case Token::Type::Number:
         case Token::Type::String:
+        case Token::Type::Reference:
             // If the token is a number, then add it to the output queue
             queue.push_back(token);
             break;
@@ -340,6 +346,35 @@ bool isnum(const std::string & s) {
 }
 
 
+// copy the command at f with length l from the lower case expression and add "/value"
+static void reference_cmd(const std::string & expr_lower, size_t f, size_t l, char * cmd, size_t size) {
+    expr_lower.copy(cmd, l, f);
+    cmd[l] = '\0';
+
+    if (strstr(cmd, "/value") == nullptr) {
+        strlcat(cmd, "/value", size - 6);
+    }
+}
+
+// get the value of a single command like "<device>/<hc>/<cmd>/value" via the API
+// returns false if the command failed, data is empty if the entity has no value
+static bool command_value(const char * cmd, std::string & data) {
+    JsonDocument doc_out;
+    JsonDocument doc_in;
+    JsonObject   output = doc_out.to<JsonObject>();
+    JsonObject   input  = doc_in.to<JsonObject>();
+    std::string  cmd_s  = "api/" + std::string(cmd);
+
+    auto return_code = Command::execute(cmd_s.c_str(), true, input, output);
+    // check for no value (entity is valid but has no value set)
+    if (return_code != CommandRet::OK && return_code != CommandRet::NO_VALUE) {
+        return false;
+    }
+
+    data = output["api_data"] | "";
+    return true;
+}
+
 // replace commands like "<device>/<hc>/<cmd>" with its value"
 std::string commands(std::string & expr, bool quotes) {
     auto expr_new = Helpers::toLower(expr);
@@ -357,25 +392,13 @@ std::string commands(std::string & expr, bool quotes) {
             if (l >= sizeof(cmd) - 1) {
                 break;
             }
-            expr_new.copy(cmd, l, f);
-            cmd[l] = '\0';
-
-            if (strstr(cmd, "/value") == nullptr) {
-                strlcat(cmd, "/value", sizeof(cmd) - 6);
-            }
-            JsonDocument doc_out;
-            JsonDocument doc_in;
-            JsonObject   output = doc_out.to<JsonObject>();
-            JsonObject   input  = doc_in.to<JsonObject>();
-            std::string  cmd_s  = "api/" + std::string(cmd);
+            reference_cmd(expr_new, f, l, cmd, sizeof(cmd));
 
-            auto return_code = Command::process(cmd_s.c_str(), true, input, output);
-            // check for no value (entity is valid but has no value set)
-            if (return_code != CommandRet::OK && return_code != CommandRet::NO_VALUE) {
+            std::string data;
+            if (!command_value(cmd, data)) {
                 return expr = "";
             }
 
-            std::string data = output["api_data"] | "";
             if (!isnum(data) && quotes) {
                 data.insert(data.begin(), '"');
                 data.insert(data.end(), '"');
@@ -440,237 +463,7 @@ std::string to_hex(uint32_t i) {
 
 // RPN calculator
 std::string calculate(const std::string & expr) {
-    std::string expr_new = expr;
-    // commands(expr_new);
-
-    const auto tokens = exprToTokens(expr_new);
-    // for debugging only
-    // for (const auto & t : tokens) {
-    //     EMSESP::logger().debug("shunt token: %s(%d)", t.str.c_str(), t.type);
-    //     Serial.printf("shunt token: %s(%d)\n", t.str.c_str(), t.type);
-    //     Serial.println();
-    // }
-    if (tokens.empty()) {
-        return "";
-    }
-
-    auto queue = shuntingYard(tokens);
-    if (queue.empty()) {
-        return "";
-    }
-
-    std::vector<std::string> stack;
-
-    while (!queue.empty()) {
-        const auto token = queue.front();
-        queue.pop_front();
-        switch (token.type) {
-        case Token::Type::Number:
-        case Token::Type::String:
-            stack.push_back(token.str);
-            break;
-        case Token::Type::Unary: {
-            if (stack.empty()) {
-                return "";
-            }
-            const auto rhs = stack.back();
-            stack.pop_back();
-            if (token.str[0] == '!') {
-                if (to_logic(rhs) < 0) {
-                }
-                if (to_logic(rhs) >= 0) {
-                    stack.push_back(to_logic(rhs) == 0 ? "1" : "0");
-                } else if (isnum(rhs)) {
-                    stack.push_back(std::stod(rhs) == 0 ? "1" : "0");
-                } else {
-                    EMSESP::logger().warning("missing operator");
-                    return "";
-                }
-                break;
-            }
-            auto rhd = std::stod(rhs);
-            switch (token.str[0]) {
-            default:
-                return "";
-                break;
-            case 'm': // Special operator name for unary '-'
-                stack.push_back(to_string(-1 * rhd));
-                break;
-            case 'i':
-                stack.push_back(to_string(static_cast<int>(rhd)));
-                break;
-            case 'r':
-                stack.push_back(to_string(std::round(rhd)));
-                break;
-            case 'a':
-                stack.push_back(to_string(std::abs(rhd)));
-                break;
-            case 'e':
-                stack.push_back(to_string(std::exp(rhd)));
-                break;
-            case 'l':
-                stack.push_back(to_string(std::log(rhd)));
-                break;
-            case 'g':
-                stack.push_back(to_string(std::log10(rhd)));
-                break;
-            case 's':
-                stack.push_back(to_string(std::sqrt(rhd)));
-                break;
-            case 'p':
-                stack.push_back(to_string(std::pow(rhd, 2)));
-                break;
-            case 'h':
-                stack.push_back(to_string(std::stoi(rhs, 0, 16)));
-                break;
-            case 'x':
-                stack.push_back(to_hex(static_cast<int>(rhd)));
-                break;
-            case 'd':
-#ifndef EMSESP_STANDALONE
-                stack.push_back(to_string(rhd * esp_random() / UINT32_MAX));
-#else
-                stack.push_back(to_string(rhd * rand() / RAND_MAX));
-#endif
-                break;
-            }
-        } break;
-        case Token::Type::Compare: {
-            if (stack.size() < 2) {
-                return "";
-            }
-            const auto rhs = stack.back();
-            stack.pop_back();
-            const auto lhs = stack.back();
-            stack.pop_back();
-            switch (token.str[0]) {
-            default:
-                return "";
-                break;
-            case '<':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) < std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                stack.push_back((lhs < rhs) ? "1" : "0");
-                break;
-            case '{':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) <= std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                stack.push_back((lhs <= rhs) ? "1" : "0");
-                break;
-            case '>':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) > std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                stack.push_back((lhs > rhs) ? "1" : "0");
-                break;
-            case '}':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) >= std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                stack.push_back((lhs >= rhs) ? "1" : "0");
-                break;
-            case '=':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) == std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                // compare strings lower case
-                stack.push_back((Helpers::toLower(lhs) == Helpers::toLower(rhs)) ? "1" : "0");
-                break;
-            case '!':
-                if (isnum(rhs) && isnum(lhs)) {
-                    stack.push_back((std::stod(lhs) != std::stod(rhs)) ? "1" : "0");
-                    break;
-                }
-                // compare strings lower case
-                stack.push_back((Helpers::toLower(lhs) != Helpers::toLower(rhs)) ? "1" : "0");
-                break;
-            }
-        } break;
-        case Token::Type::Logic: {
-            // binary operators
-            if (stack.size() < 2) {
-                return "";
-            }
-            const auto rhs = to_logic(stack.back());
-            stack.pop_back();
-            const auto lhs = to_logic(stack.back());
-            stack.pop_back();
-            if (rhs < 0 || lhs < 0) {
-                return "";
-            }
-            switch (token.str[0]) {
-            default:
-                return "";
-                break;
-            case '&':
-                stack.push_back((lhs && rhs) ? "1" : "0");
-                break;
-            case '|':
-                stack.push_back((lhs || rhs) ? "1" : "0");
-                break;
-            }
-        } break;
-        case Token::Type::Operator: {
-            // binary operators
-            if (stack.size() < 2) {
-                return "";
-            }
-            const auto rhs = stack.back();
-            stack.pop_back();
-            const auto lhs = stack.back();
-            stack.pop_back();
-            if (token.str[0] == '+' && (!isnum(rhs) || !isnum(lhs))) {
-                stack.push_back(lhs + rhs);
-                break;
-            }
-            auto lhd = std::stod(lhs);
-            auto rhd = std::stod(rhs);
-            switch (token.str[0]) {
-            default:
-                return "";
-                break;
-            case '^':
-                stack.push_back(to_string(pow(lhd, rhd)));
-                break;
-            case '*':
-                stack.push_back(to_string(lhd * rhd));
-                break;
-            case '/':
-                stack.push_back(to_string(lhd / rhd));
-                break;
-            case '%':
-                stack.push_back(std::to_string(static_cast<int>(lhd) % static_cast<int>(rhd)));
-                break;
-            case '+':
-                stack.push_back(to_string(lhd + rhd));
-                break;
-            case '-':
-                stack.push_back(to_string(lhd - rhd));
-                break;
-            }
-        } break;
-        case Token::Type::LeftParen:
-        case Token::Type::RightParen:
-        case Token::Type::Unknown:
-        default:
-            return "";
-            break;
-        }
-    }
-
-    // concatenate all elements in stack to a single string, separated by spaces and return
-    std::string result = "";
-    for (const auto & s : stack) {
-        result += s;
-    }
-    return result;
+    return Expression::calculate(expr);
 }
 
 // check for multiple instances of <cond> ? <expr1> : <expr2>
@@ -814,4 +607,556 @@ std::string compute(const std::string & expr) {
     return calculate(expr_new);
 }
 
-} // namespace emsesp
\ No newline at end of file
+// find the entity references and load the expression, see load()
+void Expression::compile(const std::string & expr) {
+    interpreted_ = false;
+    source_.clear();
+    program_.clear();
+    constants_.clear();
+    refs_.clear();
+    bound_version_ = 0;
+    stack_.clear();
+
+    // the ternary operator, json/url and the removal of "" work on the text, leave these to compute()
+    if (expr.find_first_of("?{") != std::string::npos || expr.find("\"\"") != std::string::npos) {
+        interpreted_ = true;
+        source_      = expr;
+        return;
+    }
+
+    // find commands like "<device>/<hc>/<cmd>" as commands() does, and replace each by a marker
+    auto                                   expr_lower = Helpers::toLower(expr);
+    std::vector<std::pair<size_t, size_t>> found; // position and length
+    for (uint8_t device = 0; device < EMSdevice::DeviceType::UNKNOWN; device++) {
+        std::string d = (std::string)EMSdevice::device_type_2_device_name(device) + "/";
+        auto        f = expr_lower.find(d);
+        while (f != std::string::npos) {
+            auto e = expr_lower.find_first_not_of("/._abcdefghijklmnopqrstuvwxyz0123456789", f);
+            if (e == std::string::npos) {
+                e = expr.length();
+            }
+            if (e - f >= COMMAND_MAX_LENGTH - 1) {
+                break;
+            }
+            found.emplace_back(f, e - f);
+            f = expr_lower.find(d, e);
+        }
+    }
+    std::sort(found.begin(), found.end());
+
+    std::string marked;
+    size_t      last = 0;
+    for (const auto & r : found) {
+        if (r.first < last) {
+            continue; // part of a command found before
+        }
+        char cmd[COMMAND_MAX_LENGTH];
+        reference_cmd(expr_lower, r.first, r.second, cmd, sizeof(cmd));
+        refs_.emplace_back();
+        refs_.back().cmd_ = cmd;
+        marked.append(expr, last, r.first - last);
+        marked += EXPR_REFERENCE;
+        last = r.first + r.second;
+    }
+    marked.append(expr, last, std::string::npos);
+
+    load(marked);
+}
+
+// tokenize and sort to RPN, keep the constants pre-parsed
+void Expression::load(const std::string & expr) {
+    const auto tokens = exprToTokens(expr);
+    if (tokens.empty()) {
+        return;
+    }
+    const auto queue = shuntingYard(tokens);
+
+    // the RPN keeps the operands in order, so references are numbered as they were found
+    uint16_t ref = 0;
+    for (const auto & token : queue) {
+        switch (token.type) {
+        case Token::Type::Number:
+        case Token::Type::String:
+            program_.push_back({token.type, 0, (uint16_t)constants_.size()});
+            constants_.push_back(from_string(token.str));
+            break;
+        case Token::Type::Reference:
+            if (ref >= refs_.size()) {
+                program_.clear(); // no reference was found here
+                return;
+            }
+            program_.push_back({token.type, 0, ref++});
+            break;
+        case Token::Type::Unary:
+        case Token::Type::Compare:
+        case Token::Type::Logic:
+        case Token::Type::Operator:
+            program_.push_back({token.type, token.str[0], 0});
+            break;
+        case Token::Type::LeftParen:
+        case Token::Type::RightParen:
+        case Token::Type::Unknown:
+        default:
+            program_.clear(); // mismatched parentheses, nothing to calculate
+            return;
+        }
+    }
+    stack_.reserve(program_.size());
+}
+
+Expression::Value Expression::from_string(const std::string & s) {
+    Value v;
+    v.str_     = s;
+    v.has_str_ = true;
+    v.is_num_  = isnum(s);
+    if (v.is_num_) {
+        v.num_ = strtod(s.c_str(), nullptr);
+    }
+    return v;
+}
+
+// same as to_string(), which gives "nan" or "inf" for these
+Expression::Value Expression::from_number(double d) {
+    Value v;
+    v.num_    = d;
+    v.is_num_ = std::isfinite(d);
+    return v;
+}
+
+Expression::Value Expression::from_bool(bool b) {
+    Value v;
+    v.num_     = b;
+    v.is_num_  = true;
+    v.str_     = b ? "1" : "0";
+    v.has_str_ = true;
+    return v;
+}
+
+const std::string & Expression::str(Value & v) {
+    if (!v.has_str_) {
+        v.str_     = to_string(v.num_);
+        v.has_str_ = true;
+    }
+    return v.str_;
+}
+
+// like std::stod, false if the string doesn't start with a number
+bool Expression::number(const Value & v, double & d) {
+    if (v.is_num_ || !v.has_str_) {
+        d = v.num_;
+        return true;
+    }
+    char * end;
+    d = strtod(v.str_.c_str(), &end);
+    return end != v.str_.c_str();
+}
+
+int Expression::logic(Value & v) {
+    const auto & s = str(v);
+    if (s == "1") {
+        return 1;
+    }
+    if (s == "0") {
+        return 0;
+    }
+    return to_logic(s);
+}
+
+// resolve a reference to the device values or custom entity Command::process() would read for it
+void Expression::bind(Ref & ref) {
+    ref.values_.clear();
+    ref.custom_ = nullptr;
+
+    char         device_s[COMMAND_MAX_LENGTH];
+    const char * cmd_p = strchr(ref.cmd_.c_str(), '/');
+    strlcpy(device_s, ref.cmd_.c_str(), cmd_p - ref.cmd_.c_str() + 1);
+    cmd_p++;
+
+    uint8_t device_type = EMSdevice::device_name_2_device_type(device_s);
+    int8_t  id          = -1;
+    if (device_type >= EMSdevice::DeviceType::BOILER) {
+        cmd_p = Command::parse_command_string(cmd_p, id);
+    }
+    if (cmd_p == nullptr) {
+        return;
+    }
+
+    // only "<cmd>/value", other attributes are left to the API
+    char   cmd[COMMAND_MAX_LENGTH];
+    size_t l = strcspn(cmd_p, "/");
+    if (strcmp(cmd_p + l, "/value") != 0 || l >= sizeof(cmd)) {
+        return;
+    }
+    strlcpy(cmd, cmd_p, l + 1);
+
+    if (device_type == EMSdevice::DeviceType::CUSTOM) {
+        ref.custom_ = EMSESP::webCustomEntityService.find_entity(cmd);
+        return;
+    }
+
+    for (const auto & emsdevice : EMSESP::emsdevices) {
+        if (emsdevice->device_type() == device_type) {
+            int slot = emsdevice->get_value_slot(cmd, id);
+            if (slot >= 0) {
+                ref.values_.emplace_back(emsdevice.get(), slot);
+            }
+        }
+    }
+}
+
+// read the value of a reference, false if the command failed, data is empty if the entity has no value
+bool Expression::read(const Ref & ref, std::string & data) {
+    if (ref.custom_) {
+        if (!EMSESP::webCustomEntityService.get_value_string(*ref.custom_, data)) {
+            data.clear();
+        }
+        return true;
+    }
+    if (ref.values_.empty()) {
+        return command_value(ref.cmd_.c_str(), data);
+    }
+    // the first device with a value, if none has one the entity has no value
+    for (const auto & value : ref.values_) {
+        if (value.first->get_value_string(value.second, data)) {
+            return true;
+        }
+    }
+    data.clear();
+    return true;
+}
+
+// bind all references again after devices or entities have changed
+void Expression::bind_refs() {
+    if (bound_version_ != EMSESP::entity_bindings_version()) {
+        for (auto & ref : refs_) {
+            bind(ref);
+        }
+        bound_version_ = EMSESP::entity_bindings_version();
+    }
+}
+
+// collect the Helpers::hash_lower() of the entities the expression reads, as they are passed to WebSchedulerService::onChange()
+// returns false if it also reads something that doesn't report its changes
+bool Expression::dependencies(std::vector<uint32_t> & hashes) {
+    hashes.clear();
+    if (interpreted_) {
+        return false;
+    }
+    bind_refs();
+
+    bool tracked = true;
+    char cmd[COMMAND_MAX_LENGTH];
+    for (const auto & ref : refs_) {
+        if (ref.custom_) {
+            snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), ref.custom_->name);
+            hashes.push_back(Helpers::hash_lower(cmd));
+            continue;
+        }
+        if (!ref.values_.empty()) {
+            for (const auto & value : ref.values_) {
+                hashes.push_back(Helpers::hash_lower(value.first->value_cmd(cmd, sizeof(cmd), value.first->devicevalues_[value.second])));
+            }
+            continue;
+        }
+        // sensors are read with the API, "<sensor>/<name>/value" reports changes as "<sensor>/<name>"
+        size_t  name        = ref.cmd_.find('/') + 1;
+        size_t  end         = ref.cmd_.find('/', name);
+        uint8_t device_type = EMSdevice::device_name_2_device_type(ref.cmd_.substr(0, name - 1).c_str());
+        if ((device_type == EMSdevice::DeviceType::TEMPERATURESENSOR || device_type == EMSdevice::DeviceType::ANALOGSENSOR)
+            && end != std::string::npos && ref.cmd_.compare(end, std::string::npos, "/value") == 0) {
+            hashes.push_back(Helpers::hash_lower(ref.cmd_.substr(0, end).c_str()));
+            continue;
+        }
+        tracked = false;
+    }
+    return tracked;
+}
+
+// bit per device type the expression reads from
+uint32_t Expression::device_types() const {
+    uint32_t types = 0;
+    for (const auto & ref : refs_) {
+        types |= (uint32_t)1 << EMSdevice::device_name_2_device_type(ref.cmd_.substr(0, ref.cmd_.find('/')).c_str());
+    }
+    return types;
+}
+
+// the calculator of calculate(), tokenized and sorted for each call
+std::string Expression::calculate(const std::string & expr) {
+    Expression e;
+    e.load(expr);
+    return e.run();
+}
+
+// evaluate the compiled program, as compute() would on the source expression
+std::string Expression::evaluate() {
+    if (interpreted_) {
+        return compute(source_);
+    }
+    if (program_.empty()) {
+        return "";
+    }
+
+    bind_refs();
+    return run();
+}
+
+// RPN calculator, numbers stay doubles and are only converted to a string when needed
+std::string Expression::run() {
+    stack_.clear();
+
+    for (const auto & op : program_) {
+        switch (op.type_) {
+        case Token::Type::Number:
+        case Token::Type::String:
+            stack_.push_back(constants_[op.arg_]);
+            break;
+        case Token::Type::Reference: {
+            std::string data;
+            // an entity without a value is removed from the expression by compute(), which then can't be calculated
+            if (!read(refs_[op.arg_], data) || data.empty()) {
+                return "";
+            }
+            stack_.push_back(from_string(data));
+        } break;
+        case Token::Type::Unary:
+        case Token::Type::Compare:
+        case Token::Type::Logic:
+        case Token::Type::Operator:
+            if (!operate(op, stack_)) {
+                return "";
+            }
+            break;
+        case Token::Type::LeftParen:
+        case Token::Type::RightParen:
+        case Token::Type::Unknown:
+        default:
+            return "";
+        }
+    }
+
+    // concatenate all elements in stack to a single string
+    std::string result;
+    for (auto & v : stack_) {
+        result += str(v);
+    }
+    return result;
+}
+
+// apply an operator to the top of the stack, false if it can't be calculated
+bool Expression::operate(const Op & op, std::vector<Value> & stack) {
+    switch (op.type_) {
+    case Token::Type::Unary: {
+        if (stack.empty()) {
+            return false;
+        }
+        Value rhs = std::move(stack.back());
+        stack.pop_back();
+        if (op.op_ == '!') {
+            auto l = logic(rhs);
+            if (l >= 0) {
+                stack.push_back(from_bool(l == 0));
+            } else if (rhs.is_num_) {
+                stack.push_back(from_bool(rhs.num_ == 0));
+            } else {
+                EMSESP::logger().warning("missing operator");
+                return false;
+            }
+            break;
+        }
+        if (op.op_ == 'h') {
+            const auto & s = str(rhs);
+            char *       end;
+            long         h = strtol(s.c_str(), &end, 16);
+            if (end == s.c_str()) {
+                return false;
+            }
+            stack.push_back(from_number(h));
+            break;
+        }
+        double rhd;
+        if (!number(rhs, rhd)) {
+            return false;
+        }
+        switch (op.op_) {
+        default:
+            return false;
+            break;
+        case 'm': // Special operator name for unary '-'
+            stack.push_back(from_number(-1 * rhd));
+            break;
+        case 'i':
+            stack.push_back(from_number(static_cast<int>(rhd)));
+            break;
+        case 'r':
+            stack.push_back(from_number(std::round(rhd)));
+            break;
+        case 'a':
+            stack.push_back(from_number(std::abs(rhd)));
+            break;
+        case 'e':
+            stack.push_back(from_number(std::exp(rhd)));
+            break;
+        case 'l':
+            stack.push_back(from_number(std::log(rhd)));
+            break;
+        case 'g':
+            stack.push_back(from_number(std::log10(rhd)));
+            break;
+        case 's':
+            stack.push_back(from_number(std::sqrt(rhd)));
+            break;
+        case 'p':
+            stack.push_back(from_number(std::pow(rhd, 2)));
+            break;
+        case 'x':
+            stack.push_back(from_string(to_hex(static_cast<int>(rhd))));
+            break;
+        case 'd':
+#ifndef EMSESP_STANDALONE
+            stack.push_back(from_number(rhd * esp_random() / UINT32_MAX));
+#else
+            stack.push_back(from_number(rhd * rand() / RAND_MAX));
+#endif
+            break;
+        }
+    } break;
+    case Token::Type::Compare: {
+        if (stack.size() < 2) {
+            return false;
+        }
+        Value rhs = std::move(stack.back());
+        stack.pop_back();
+        Value lhs = std::move(stack.back());
+        stack.pop_back();
+        bool result;
+        if (lhs.is_num_ && rhs.is_num_) {
+            switch (op.op_) {
+            default:
+                return false;
+            case '<':
+                result = lhs.num_ < rhs.num_;
+                break;
+            case '{':
+                result = lhs.num_ <= rhs.num_;
+                break;
+            case '>':
+                result = lhs.num_ > rhs.num_;
+                break;
+            case '}':
+                result = lhs.num_ >= rhs.num_;
+                break;
+            case '=':
+                result = lhs.num_ == rhs.num_;
+                break;
+            case '!':
+                result = lhs.num_ != rhs.num_;
+                break;
+            }
+        } else {
+            const auto & l = str(lhs);
+            const auto & r = str(rhs);
+            switch (op.op_) {
+            default:
+                return false;
+            case '<':
+                result = l < r;
+                break;
+            case '{':
+                result = l <= r;
+                break;
+            case '>':
+                result = l > r;
+                break;
+            case '}':
+                result = l >= r;
+                break;
+            case '=': // compare strings lower case
+                result = strcasecmp(l.c_str(), r.c_str()) == 0;
+                break;
+            case '!':
+                result = strcasecmp(l.c_str(), r.c_str()) != 0;
+                break;
+            }
+        }
+        stack.push_back(from_bool(result));
+    } break;
+    case Token::Type::Logic: {
+        // binary operators
+        if (stack.size() < 2) {
+            return false;
+        }
+        const auto rhs = logic(stack.back());
+        stack.pop_back();
+        const auto lhs = logic(stack.back());
+        stack.pop_back();
+        if (rhs < 0 || lhs < 0) {
+            return false;
+        }
+        switch (op.op_) {
+        default:
+            return false;
+        case '&':
+            stack.push_back(from_bool(lhs && rhs));
+            break;
+        case '|':
+            stack.push_back(from_bool(lhs || rhs));
+            break;
+        }
+    } break;
+    case Token::Type::Operator: {
+        // binary operators
+        if (stack.size() < 2) {
+            return false;
+        }
+        Value rhs = std::move(stack.back());
+        stack.pop_back();
+        Value lhs = std::move(stack.back());
+        stack.pop_back();
+        if (op.op_ == '+' && (!rhs.is_num_ || !lhs.is_num_)) {
+            stack.push_back(from_string(str(lhs) + str(rhs)));
+            break;
+        }
+        double lhd, rhd;
+        if (!number(lhs, lhd) || !number(rhs, rhd)) {
+            return false;
+        }
+        switch (op.op_) {
+        default:
+            return false;
+        case '^':
+            stack.push_back(from_number(pow(lhd, rhd)));
+            break;
+        case '*':
+            stack.push_back(from_number(lhd * rhd));
+            break;
+        case '/':
+            stack.push_back(from_number(lhd / rhd));
+            break;
+        case '%':
+            if (static_cast<int>(rhd) == 0) {
+                return false;
+            }
+            stack.push_back(from_number(static_cast<int>(lhd) % static_cast<int>(rhd)));
+            break;
+        case '+':
+            stack.push_back(from_number(lhd + rhd));
+            break;
+        case '-':
+            stack.push_back(from_number(lhd - rhd));
+            break;
+        }
+    } break;
+    case Token::Type::Number:
+    case Token::Type::String:
+    case Token::Type::Reference:
+    case Token::Type::LeftParen:
+    case Token::Type::RightParen:
+    case Token::Type::Unknown:
+    default:
+        return false;
+    }
+    return true;
+}
+
+} // namespace emsesp
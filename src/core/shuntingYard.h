@@ -43,6 +43,7 @@ class Token {
         Unary,
         LeftParen,
         RightParen,
+        Reference, // "<device>/<hc>/<cmd>", only used by Expression
     };
 
     Token(Type type, const std::string & s, int8_t precedence = -1, bool rightAssociative = false)
@@ -85,6 +86,77 @@ std::string calculate(const std::string & expr);
 // check for multiple instances of <cond> ? <expr1> : <expr2>
 std::string compute(const std::string & expr);
 
-#endif
+class EMSdevice;
+class CustomEntityItem;
 
-} // namespace emsesp
\ No newline at end of file
+// An expression tokenized and sorted to RPN once, so evaluating it only runs the calculator.
+// Entity references are bound to the device value or custom entity they read, and bound again
+// after devices or entities have changed. Expressions with <cond> ? <expr1> : <expr2>,
+// json/url blocks or empty strings ("") are kept as text and evaluated with compute().
+// calculate() runs the same calculator, which keeps numbers as doubles at full precision
+// and only converts them to text for string operations and the result.
+class Expression {
+  public:
+    Expression() = default;
+    explicit Expression(const std::string & expr) {
+        compile(expr);
+    }
+
+    static std::string calculate(const std::string & expr);
+
+    void        compile(const std::string & expr);
+    std::string evaluate();
+    bool        dependencies(std::vector<uint32_t> & hashes);
+    uint32_t    device_types() const;
+
+    bool interpreted() const {
+        return interpreted_;
+    }
+
+  private:
+    // a value on the calculator stack, computed numbers are only converted to a string when needed
+    struct Value {
+        double      num_     = 0;
+        bool        is_num_  = false; // isnum() of the string
+        bool        has_str_ = false;
+        std::string str_;
+    };
+
+    struct Op {
+        Token::Type type_;
+        char        op_;  // operator for Unary, Compare, Logic and Operator
+        uint16_t    arg_; // index in constants_ for Number and String, in refs_ for Reference
+    };
+
+    static Value               from_string(const std::string & s);
+    static Value               from_number(double d);
+    static Value               from_bool(bool b);
+    // an entity reference, references that can't be bound (sensors, system, other attributes) are read with the API
+    struct Ref {
+        std::string                                   cmd_;              // "<device>/<hc>/<cmd>/value"
+        std::vector<std::pair<EMSdevice *, uint16_t>> values_;           // device and slot, in the order the API searches them
+        CustomEntityItem *                            custom_ = nullptr; // or the custom entity
+    };
+
+    static const std::string & str(Value & v);
+    static bool                number(const Value & v, double & d);
+    static int                 logic(Value & v);
+    static bool                operate(const Op & op, std::vector<Value> & stack);
+    static void                bind(Ref & ref);
+    static bool                read(const Ref & ref, std::string & data);
+    void                       bind_refs();
+    void                       load(const std::string & expr);
+    std::string                run();
+
+    bool               interpreted_ = false;
+    std::string        source_; // only for interpreted expressions
+    std::vector<Op>    program_;
+    std::vector<Value> constants_;
+    std::vector<Ref>   refs_;
+    uint32_t           bound_version_ = 0; // EMSESP::entity_bindings_version() of refs_
+    std::vector<Value> stack_;
+};
+
+} // namespace emsesp
+
+#endif
\ No newline at end of file
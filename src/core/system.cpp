@@ -242,21 +242,34 @@ bool System::command_message(const char * value, const int8_t id, JsonObject out
         return false; // must have a string value
     }
 
-    EMSESP::webSchedulerService.computed_value.clear();
-    EMSESP::webSchedulerService.raw_value = value;
-    for (uint16_t wait = 0; wait < 2000 && !EMSESP::webSchedulerService.raw_value.empty(); wait++) {
-        delay(1);
+    // a json/url block waits for a http reply, that is done by the scheduler task and not in the main loop
+    if (strchr(value, '{')) {
+        if (!EMSESP::webSchedulerService.message(value)) {
+            LOG_WARNING("Message queue is full");
+            return false;
+        }
+        return true;
     }
 
-    if (EMSESP::webSchedulerService.computed_value.empty()) {
-        LOG_WARNING("Message result is empty");
+    // entity values in the message are read directly, we're in the main loop
+    std::string computed_value = compute(value);
+    if (!send_message(computed_value)) {
         return false;
     }
+    output["api_data"] = computed_value; // send to API
 
-    LOG_INFO("Message: %s", EMSESP::webSchedulerService.computed_value.c_str());  // send to log
-    Mqtt::queue_publish(F_(message), EMSESP::webSchedulerService.computed_value); // send to MQTT if enabled
-    output["api_data"] = EMSESP::webSchedulerService.computed_value;              // send to API
+    return true;
+}
+
+// send a computed message to the log and MQTT
+bool System::send_message(const std::string & message) {
+    if (message.empty()) {
+        LOG_WARNING("Message result is empty");
+        return false;
+    }
 
+    LOG_INFO("Message: %s", message.c_str()); // send to log
+    Mqtt::queue_publish(F_(message), message); // send to MQTT if enabled
     return true;
 }
 
@@ -1036,6 +1049,7 @@ void System::commands_init() {
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(restart), System::command_restart, FL_(restart_cmd), CommandFlag::ADMIN_ONLY);
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(format), System::command_format, FL_(format_cmd), CommandFlag::ADMIN_ONLY);
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(txpause), System::command_txpause, FL_(txpause_cmd), CommandFlag::ADMIN_ONLY);
+    Command::add(EMSdevice::DeviceType::SYSTEM, F_(capture), System::command_capture, FL_(capture_cmd), CommandFlag::ADMIN_ONLY);
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(watch), System::command_watch, FL_(watch_cmd));
     Command::add(EMSdevice::DeviceType::SYSTEM, F_(message), System::command_message, FL_(message_cmd));
 #if defined(EMSESP_TEST)
@@ -2240,6 +2254,25 @@ bool System::command_info(const char * value, const int8_t id, JsonObject output
     node["busRxLineQuality"]       = EMSESP::rxservice_.quality();
     node["busTxLineQuality"]       = (EMSESP::txservice_.read_quality() + EMSESP::txservice_.write_quality()) / 2;
 
+    // EMS Bus timing, the percentiles are the upper limit of their histogram bucket
+    node            = output["busTiming"].to<JsonObject>();
+    auto add_timing = [&](const char * name, const Histogram & histogram) {
+        JsonObject timing = node[name].to<JsonObject>();
+        timing["count"]   = histogram.count();
+        timing["p50"]     = histogram.percentile(50);
+        timing["p95"]     = histogram.percentile(95);
+        timing["max"]     = histogram.max();
+    };
+    add_timing("pollToSendUs", EMSbus::poll_to_send_);
+    add_timing("txToReplyUs", EMSbus::tx_to_reply_);
+    add_timing("writeToAckMs", EMSbus::write_to_ack_);
+    add_timing("rxQueueTimeUs", EMSbus::rx_queue_time_);
+    JsonObject retries = node["txRetries"].to<JsonObject>();
+    for (uint8_t i = 0; i <= TxService::MAXIMUM_TX_RETRIES; i++) {
+        retries["retry" + std::to_string(i)] = EMSbus::tx_retries_.count(i);
+    }
+    retries["failed"] = EMSbus::tx_retries_.count(TxService::MAXIMUM_TX_RETRIES + 1);
+
     // Settings
     node = output["settings"].to<JsonObject>();
     EMSESP::webSettingsService.read([&](const WebSettings & settings) {
@@ -2446,6 +2479,38 @@ bool System::command_txpause(const char * value, const int8_t id) {
     return true;
 }
 
+// capture command - start, stop or clear a recording of the raw bus frames for a replay in standalone
+// without a value it returns the state, the capture itself is downloaded from /rest/capture
+bool System::command_capture(const char * value, const int8_t id, JsonObject output) {
+    if (value == nullptr || value[0] == '\0') {
+        BusCapture::loop();
+        output["active"]  = BusCapture::active();
+        output["frames"]  = BusCapture::frames();
+        output["dropped"] = BusCapture::dropped();
+        output["bytes"]   = BusCapture::size();
+        return true;
+    }
+
+    if (!strcmp(value, "start")) {
+        BusCapture::start();
+        LOG_INFO("Bus capture started");
+        return true;
+    }
+
+    if (!strcmp(value, "stop")) {
+        BusCapture::stop();
+        LOG_INFO("Bus capture stopped, %d frames recorded, %d dropped", BusCapture::frames(), BusCapture::dropped());
+        return true;
+    }
+
+    if (!strcmp(value, "clear")) {
+        BusCapture::clear();
+        return true;
+    }
+
+    return false; // argument not recognized
+}
+
 // format command - factory reset, removing all config files
 bool System::command_format(const char * value, const int8_t id) {
 #if !defined(EMSESP_STANDALONE) && !defined(EMSESP_DEBUG)
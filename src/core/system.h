@@ -104,6 +104,8 @@ class System {
     static bool command_response(const char * value, const int8_t id, JsonObject output);
     static bool command_service(const char * cmd, const char * value);
     static bool command_txpause(const char * value, const int8_t id);
+    static bool command_capture(const char * value, const int8_t id, JsonObject output);
+    static bool send_message(const std::string & message);
 
     static bool        get_value_info(JsonObject root, const char * cmd);
     static void        get_value_json(JsonObject output, const std::string & circuit, const std::string & name, JsonVariant val);
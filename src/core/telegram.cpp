@@ -44,8 +44,23 @@ uint8_t  EMSbus::ems_bus_id_        = EMSESP_DEFAULT_EMS_BUS_ID;
 uint8_t  EMSbus::tx_mode_           = EMSESP_DEFAULT_TX_MODE;
 uint8_t  EMSbus::tx_state_          = Telegram::Operation::NONE;
 
+// bucket limits of the bus timing histograms
+static constexpr uint32_t BUS_TIMING_US[] = {250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000};
+static constexpr uint32_t BUS_TIMING_MS[] = {50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 60000};
+static constexpr uint32_t BUS_RETRIES[]   = {0, 1, 2, TxService::MAXIMUM_TX_RETRIES};
+
+Histogram EMSbus::poll_to_send_(BUS_TIMING_US);
+Histogram EMSbus::tx_to_reply_(BUS_TIMING_US);
+Histogram EMSbus::write_to_ack_(BUS_TIMING_MS);
+Histogram EMSbus::tx_retries_(BUS_RETRIES);
+Histogram EMSbus::rx_queue_time_(BUS_TIMING_US);
+
 uuid::log::Logger EMSbus::logger_{F_(telegram), uuid::log::Facility::CONSOLE};
 
+TelegramPool::Slot *  TelegramPool::slots_ = nullptr;
+std::atomic<uint32_t> TelegramPool::used_[TelegramPool::POOL_WORDS];
+std::atomic<uint32_t> TelegramPool::fallback_count_{0};
+
 // Calculates CRC checksum using lookup table for speed
 // length excludes the last byte (which mainly is the CRC)
 uint8_t EMSbus::calculate_crc(const uint8_t * data, const uint8_t length) {
@@ -80,6 +95,83 @@ Telegram::Telegram(const uint8_t   operation,
     }
 }
 
+// allocate the pool slots, called once at boot before the UART is started
+void TelegramPool::start() {
+    if (slots_ == nullptr) {
+        slots_ = AllocatorPSRAM<Slot>().allocate(MAX_POOLED_TELEGRAMS);
+    }
+}
+
+// claim a free slot, returns -1 if the pool is exhausted
+int16_t TelegramPool::acquire() {
+    if (slots_ == nullptr) {
+        return -1;
+    }
+
+    for (uint8_t w = 0; w < POOL_WORDS; w++) {
+        uint32_t used = used_[w].load(std::memory_order_relaxed);
+        while (used != 0xFFFFFFFF) {
+            uint8_t  bit  = __builtin_ctz(~used);
+            uint16_t slot = w * 32 + bit;
+            if (slot >= MAX_POOLED_TELEGRAMS) {
+                break;
+            }
+            // on failure used is reloaded and we try the next free bit
+            if (used_[w].compare_exchange_weak(used, used | (1U << bit), std::memory_order_acquire, std::memory_order_relaxed)) {
+                return slot;
+            }
+        }
+    }
+    return -1;
+}
+
+// creates a telegram in a free pool slot, or on the heap if the pool is exhausted
+TelegramPtr TelegramPool::create(const uint8_t   operation,
+                                 const uint8_t   src,
+                                 const uint8_t   dest,
+                                 const uint16_t  type_id,
+                                 const uint8_t   offset,
+                                 const uint8_t * message_data,
+                                 const uint8_t   message_length) {
+    int16_t slot = acquire();
+    if (slot < 0) {
+        fallback_count_.fetch_add(1, std::memory_order_relaxed);
+        return TelegramPtr(new Telegram(operation, src, dest, type_id, offset, message_data, message_length));
+    }
+
+    auto telegram        = new (slots_[slot].data_) Telegram(operation, src, dest, type_id, offset, message_data, message_length);
+    telegram->pool_slot_ = slot;
+    return TelegramPtr(telegram);
+}
+
+// gives the slot back to the pool
+void TelegramPool::release(Telegram * telegram) {
+    uint16_t slot = telegram->pool_slot_;
+    if (slot == Telegram::POOL_SLOT_HEAP) {
+        delete telegram;
+        return;
+    }
+
+    telegram->~Telegram();
+    used_[slot / 32].fetch_and(~(1U << (slot % 32)), std::memory_order_release);
+}
+
+// number of slots currently in use
+uint16_t TelegramPool::in_use() {
+    uint16_t count = 0;
+    for (const auto & used : used_) {
+        count += __builtin_popcount(used.load(std::memory_order_relaxed));
+    }
+    return count;
+}
+
+void TelegramPtr::reset() {
+    if (telegram_) {
+        TelegramPool::release(telegram_);
+        telegram_ = nullptr;
+    }
+}
+
 // returns telegram as data bytes in hex (excluding CRC)
 std::string Telegram::to_string() const {
     uint8_t data[EMS_MAX_TELEGRAM_LENGTH];
@@ -127,20 +219,65 @@ std::string Telegram::to_string_message() const {
 }
 
 // checks if we have an Rx telegram that needs processing
+// decodes and processes all raw frames handed over by the UART task
 void RxService::loop() {
-    while (!rx_telegrams_.empty()) {
-        auto telegram = rx_telegrams_.front().telegram_;
-        (void)EMSESP::process_telegram(telegram); // further process the telegram
-        increment_telegram_count();               // increase rx count
-        rx_telegrams_.pop_front();                // remove it from the queue
+    const RxFrame * frame;
+    while ((frame = rx_frames_.front()) != nullptr) {
+        rx_queue_time_.add(::micros() - frame->timestamp_);
+        decode(*frame);
+        rx_frames_.pop(); // release the slot back to the UART task
     }
+
+    uint32_t overflow_count = frame_overflow_count_.load(std::memory_order_relaxed);
+    if (overflow_count != frame_overflow_logged_) {
+        LOG_WARNING("Rx queue overflow, %d telegrams dropped", overflow_count - frame_overflow_logged_);
+        frame_overflow_logged_ = overflow_count;
+    }
+}
+
+// hand over a raw frame from the UART task to the main loop
+// this is the only Rx call made from the UART task, so it must not allocate, log or touch the Rx queue
+// if the ring is full the frame is dropped and counted, the main loop reports it
+void RxService::push(const uint8_t * data, const uint8_t length) {
+    if (length == 0 || length > EMS_MAX_TELEGRAM_LENGTH) {
+        return;
+    }
+
+    RxFrame * frame = rx_frames_.write_slot();
+    if (frame == nullptr) {
+        frame_overflow_count_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    frame->timestamp_ = ::micros();
+    frame->length_    = length;
+    memcpy(frame->data_, data, length);
+    rx_frames_.push();
+}
+
+// decode a raw frame from the ring and process it
+void RxService::decode(const RxFrame & frame) {
+    if (frame.length_) {
+        add(frame.data_, frame.length_);
+        return;
+    }
+
+    // empty telegram from add_empty()
+    process(TelegramPool::create(
+        Telegram::Operation::RX, frame.data_[0], frame.data_[1], (frame.data_[2] << 8) + frame.data_[3], frame.data_[4], nullptr, 0));
 }
 
-// add a new rx telegram object
+// hand a decoded telegram to the EMS devices. The telegram is released when the handle goes out of scope
+void RxService::process(const TelegramPtr & telegram) {
+    (void)EMSESP::process_telegram(*telegram);
+    increment_telegram_count(); // increase rx count
+}
+
+// decode a new rx telegram and process it
 // data is the whole telegram, assuming last byte holds the CRC
 // length includes the CRC
 // for EMS+ the type_id has the value + 256. We look for these type of telegrams with F7, F9 and FF in 3rd byte
-void RxService::add(uint8_t * data, uint8_t length) {
+void RxService::add(const uint8_t * data, const uint8_t length) {
     if (length < 5) {
         return;
     }
@@ -181,9 +318,9 @@ void RxService::add(uint8_t * data, uint8_t length) {
     uint8_t offset    = data[3];        // offset is always 4th byte
     uint8_t operation = (data[1] & 0x80) ? Telegram::Operation::RX_READ : Telegram::Operation::RX;
 
-    uint16_t  type_id;
-    uint8_t * message_data;   // where the message block starts
-    uint8_t   message_length; // length of the message block, excluding CRC
+    uint16_t        type_id;
+    const uint8_t * message_data;   // where the message block starts
+    uint8_t         message_length; // length of the message block, excluding CRC
 
     // work out depending on the type, where the data message block starts and the message length
     // EMS 1 has type_id always in data[2], if it gets a ems+ inquiry it will reply with FF but short length
@@ -229,26 +366,27 @@ void RxService::add(uint8_t * data, uint8_t length) {
         return;
     }
 
-    // create the telegram
-    auto telegram = std::make_shared<Telegram>(operation, src, dest, type_id, offset, message_data, message_length);
-
-// check if queue is full, if so remove top item to make space, except if we're in standalone mode
-#ifndef EMSESP_STANDALONE
-    if (rx_telegrams_.size() >= MAX_RX_TELEGRAMS) {
-        rx_telegrams_.pop_front();
-    }
-#endif
-
-    rx_telegrams_.emplace_back(rx_telegram_id_++, std::move(telegram)); // add to queue
+    // create the telegram and process it
+    process(TelegramPool::create(operation, src, dest, type_id, offset, message_data, message_length));
 }
 
 // add empty telegram to rx-queue
+// called from the UART task when a read fails, so it goes through the ring like any other frame
 void RxService::add_empty(const uint8_t src, const uint8_t dest, const uint16_t type_id, uint8_t offset) {
-    auto telegram = std::make_shared<Telegram>(Telegram::Operation::RX, src, dest, type_id, offset, nullptr, 0);
-    // only if queue is not full
-    if (rx_telegrams_.size() < MAX_RX_TELEGRAMS) {
-        rx_telegrams_.emplace_back(rx_telegram_id_++, std::move(telegram)); // add to queue
+    RxFrame * frame = rx_frames_.write_slot();
+    if (frame == nullptr) {
+        frame_overflow_count_.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
+
+    frame->timestamp_ = ::micros();
+    frame->length_    = 0;
+    frame->data_[0]   = src;
+    frame->data_[1]   = dest;
+    frame->data_[2]   = type_id >> 8;
+    frame->data_[3]   = type_id & 0xFF;
+    frame->data_[4]   = offset;
+    rx_frames_.push();
 }
 
 // start and initialize Tx
@@ -321,7 +459,7 @@ void TxService::send_telegram(const QueuedTxTelegram & tx_telegram) {
     static uint8_t telegram_raw[EMS_MAX_TELEGRAM_LENGTH];
 
     // build the header
-    auto telegram = tx_telegram.telegram_;
+    const auto & telegram = tx_telegram.telegram_;
 
     // src - set MSB if it's Junkers/HT3
     uint8_t src = telegram->src;
@@ -385,7 +523,7 @@ void TxService::send_telegram(const QueuedTxTelegram & tx_telegram) {
         }
     }
     // make a copy of the telegram with new dest (without read-flag)
-    telegram_last_ = std::make_shared<Telegram>(
+    telegram_last_ = TelegramPool::create(
         telegram->operation, telegram->src, dest & 0x7F, telegram->type_id, telegram->offset, telegram->message_data, telegram->message_length);
 
     uint8_t length       = message_p;
@@ -405,6 +543,8 @@ void TxService::send_telegram(const QueuedTxTelegram & tx_telegram) {
               Helpers::data_to_hex(telegram_raw, length - 1).c_str()); // exclude the last CRC byte
 
     set_post_send_query(tx_telegram.validateid_);
+    telegram_last_queued_ = tx_telegram.queued_;
+    telegram_last_sent_   = ::micros();
 
     //
     // this is the core send command to the UART
@@ -444,31 +584,67 @@ void TxService::add(const uint8_t  operation,
                     const uint8_t  message_length,
                     const uint16_t validateid,
                     const bool     front) {
-    auto telegram = std::make_shared<Telegram>(operation, ems_bus_id(), dest, type_id, offset, message_data, message_length);
+    auto telegram = TelegramPool::create(operation, ems_bus_id(), dest, type_id, offset, message_data, message_length);
 
     LOG_DEBUG("New Tx [#%d] telegram, length %d", tx_telegram_id_, message_length);
 
+    if (!front) {
+        queue_telegram(std::move(telegram), validateid, TX_PRIORITY_FETCH);
+    } else {
+        queue_telegram(std::move(telegram), validateid, operation == Telegram::Operation::TX_READ ? TX_PRIORITY_VALIDATE : TX_PRIORITY_USER);
+    }
+    if (validateid != 0) {
+        EMSESP::wait_validate(validateid);
+    }
+}
+
+// add a telegram to the Tx queue, behind all others with the same or a higher priority
+// a read already waiting is not queued again, a write to a value already waiting replaces the data (last one wins)
+void TxService::queue_telegram(TelegramPtr && telegram, const uint16_t validateid, const uint8_t priority) {
+    auto operation = telegram->operation;
+    if (operation == Telegram::Operation::TX_READ || operation == Telegram::Operation::TX_WRITE) {
+        for (auto it = tx_telegrams_.begin(); it != tx_telegrams_.end(); ++it) {
+            const auto & queued = *it->telegram_;
+            if (it->retry_ || queued.operation != operation || queued.dest != telegram->dest || queued.type_id != telegram->type_id
+                || queued.offset != telegram->offset || queued.message_length != telegram->message_length) {
+                continue;
+            }
+            if (operation == Telegram::Operation::TX_WRITE) {
+                LOG_DEBUG("Tx [#%d] write replaced", it->id_);
+                it->telegram_   = std::move(telegram);
+                it->validateid_ = validateid;
+                return;
+            }
+            if (queued.message_data[0] == telegram->message_data[0]) {
+                if (it->priority_ <= priority) {
+                    LOG_DEBUG("Tx [#%d] read already queued", it->id_);
+                    return;
+                }
+                tx_telegrams_.erase(it); // queue it again with the higher priority
+                break;
+            }
+        }
+    }
+
 #ifndef EMSESP_STANDALONE
-    // if the queue is full, make room by removing the last one
+    // if the queue is full, make room by removing the last one, or skip this one if it is not more important
     if (tx_telegrams_.size() >= MAX_TX_TELEGRAMS) {
         LOG_WARNING("Tx queue overflow, skip one message");
-        if (tx_telegrams_.front().telegram_->operation == Telegram::Operation::TX_WRITE) {
+        bool skip_new = tx_telegrams_.back().priority_ <= priority;
+        if ((skip_new ? operation : tx_telegrams_.back().telegram_->operation) == Telegram::Operation::TX_WRITE) {
             telegram_write_fail_count_++;
         } else {
             telegram_read_fail_count_++;
         }
-        tx_telegrams_.pop_front();
+        if (skip_new) {
+            return;
+        }
+        tx_telegrams_.pop_back();
     }
 #endif
 
-    if (front) {
-        tx_telegrams_.emplace_front(tx_telegram_id_++, std::move(telegram), false, validateid); // add to front of queue
-    } else {
-        tx_telegrams_.emplace_back(tx_telegram_id_++, std::move(telegram), false, validateid); // add to back of queue
-    }
-    if (validateid != 0) {
-        EMSESP::wait_validate(validateid);
-    }
+    auto pos = std::find_if(tx_telegrams_.begin(), tx_telegrams_.end(), [priority](const QueuedTxTelegram & q) { return q.priority_ > priority; });
+    tx_telegrams_.emplace(pos, tx_telegram_id_++, std::move(telegram), false, validateid, priority, ::millis());
 }
 
 // builds a Tx telegram and adds to queue
@@ -527,25 +703,14 @@ void TxService::add(uint8_t operation, const uint8_t * data, const uint8_t lengt
         }
     }
 
-    auto telegram = std::make_shared<Telegram>(operation, src, dest, type_id, offset, message_data, message_length); // operation is TX_WRITE or TX_READ
-
-    // if the queue is full, make room by removing the last one
-    if (tx_telegrams_.size() >= MAX_TX_TELEGRAMS) {
-        LOG_WARNING("Tx queue overflow, skip one message");
-        if (tx_telegrams_.front().telegram_->operation == Telegram::Operation::TX_WRITE) {
-            telegram_write_fail_count_++;
-        } else {
-            telegram_read_fail_count_++;
-        }
-        tx_telegrams_.pop_front();
-    }
+    auto telegram = TelegramPool::create(operation, src, dest, type_id, offset, message_data, message_length); // operation is TX_WRITE or TX_READ
 
     LOG_DEBUG("New Tx [#%d] telegram, length %d", tx_telegram_id_, message_length);
 
     if (front && (operation != Telegram::Operation::TX_RAW || EMSESP::response_id() == 0)) {
-        tx_telegrams_.emplace_front(tx_telegram_id_++, std::move(telegram), false, validate_id); // add to front of queue
+        queue_telegram(std::move(telegram), validate_id, operation == Telegram::Operation::TX_READ ? TX_PRIORITY_VALIDATE : TX_PRIORITY_USER);
     } else {
-        tx_telegrams_.emplace_back(tx_telegram_id_++, std::move(telegram), false, validate_id); // add to back of queue
+        queue_telegram(std::move(telegram), validate_id, TX_PRIORITY_FETCH);
     }
     if (validate_id != 0) {
         EMSESP::wait_validate(validate_id);
@@ -597,6 +762,7 @@ bool TxService::send_raw(const char * telegram_data) {
 void TxService::retry_tx(const uint8_t operation, const uint8_t * data, const uint8_t length) {
     // have we reached the limit? if so, reset count and give up
     if (++retry_count_ > MAXIMUM_TX_RETRIES) {
+        tx_retries_.add(retry_count_);
         reset_retry_count();      // give up
         EMSESP::wait_validate(0); // do not wait for validation
         if (operation == Telegram::Operation::TX_READ) {
@@ -639,7 +805,7 @@ void TxService::retry_tx(const uint8_t operation, const uint8_t * data, const ui
     }
     // for the last try wait 2 sec before sending.
     delayed_send_ = (retry_count_ < MAXIMUM_TX_RETRIES) ? 0 : (uuid::get_uptime() + POST_SEND_DELAY);
-    tx_telegrams_.emplace_front(tx_telegram_id_++, std::move(telegram_last_), true, get_post_send_query());
+    tx_telegrams_.emplace_front(tx_telegram_id_++, std::move(telegram_last_), true, get_post_send_query(), TX_PRIORITY_URGENT, telegram_last_queued_);
 }
 
 // send a request to read the next block of data from longer telegrams
@@ -662,7 +828,9 @@ uint16_t TxService::read_next_tx(const uint8_t offset, const uint8_t length) {
         return 0;
     }
     if (offset >= telegram_last_->offset && old_length > 0 && next_length > 0) {
-        add(Telegram::Operation::TX_READ, telegram_last_->dest, telegram_last_->type_id, next_offset, &next_length, 1, 0, true);
+        queue_telegram(TelegramPool::create(Telegram::Operation::TX_READ, ems_bus_id(), telegram_last_->dest, telegram_last_->type_id, next_offset, &next_length, 1),
+                       0,
+                       TX_PRIORITY_URGENT);
         return telegram_last_->type_id;
     }
     return 0;
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <deque>
+#include <atomic>
 #include <uuid/log.h>
 
 // UART drivers
@@ -31,10 +32,13 @@
 #endif
 
 #include "helpers.h"
+#include "ringbuffer.h"
+#include "histogram.h"
 #include <esp32-psram.h>
 
-#define MAX_RX_TELEGRAMS 100 // size of Rx queue
-#define MAX_TX_TELEGRAMS 160 // size of Tx queue
+#define MAX_RX_FRAMES 64         // size of the raw Rx ring between the UART task and the main loop, must be a power of 2
+#define MAX_TX_TELEGRAMS 160     // size of Tx queue
+#define MAX_POOLED_TELEGRAMS 168 // size of the Telegram pool: the Tx queue, the last Tx, the Rx telegram being processed and some spare
 
 // default values for null values
 static constexpr uint8_t  EMS_VALUE_BOOL          = 0xFF;       // used to mark that something is a boolean
@@ -152,7 +156,102 @@ class Telegram {
     }
 
   private:
+    friend class TelegramPool;
+
+    static constexpr uint16_t POOL_SLOT_HEAP = 0xFFFF;
+
     int8_t _getDataPosition(const uint8_t index, const uint8_t size) const;
+
+    uint16_t pool_slot_ = POOL_SLOT_HEAP; // slot in the TelegramPool, or POOL_SLOT_HEAP if allocated from the heap
+};
+
+// owning handle to a Telegram from the TelegramPool, move-only
+// the telegram goes back to the pool when the handle is destroyed or reset
+class TelegramPtr {
+  public:
+    TelegramPtr() = default;
+    explicit TelegramPtr(Telegram * telegram)
+        : telegram_(telegram) {
+    }
+    ~TelegramPtr() {
+        reset();
+    }
+
+    TelegramPtr(TelegramPtr && other) noexcept
+        : telegram_(other.telegram_) {
+        other.telegram_ = nullptr;
+    }
+    TelegramPtr & operator=(TelegramPtr && other) noexcept {
+        if (this != &other) {
+            reset();
+            telegram_       = other.telegram_;
+            other.telegram_ = nullptr;
+        }
+        return *this;
+    }
+
+    TelegramPtr(const TelegramPtr &)             = delete;
+    TelegramPtr & operator=(const TelegramPtr &) = delete;
+
+    void reset();
+
+    const Telegram * get() const {
+        return telegram_;
+    }
+    const Telegram * operator->() const {
+        return telegram_;
+    }
+    const Telegram & operator*() const {
+        return *telegram_;
+    }
+    explicit operator bool() const {
+        return telegram_ != nullptr;
+    }
+
+  private:
+    Telegram * telegram_ = nullptr;
+};
+
+// fixed-size pool of Telegram objects for the Rx and Tx services, so bus traffic doesn't allocate
+// the slots are allocated once in start(), in PSRAM if available. Slots are claimed with an atomic bitmap
+// because telegrams are created and released from both the main loop and the UART task
+// if the pool is exhausted (or not started yet) telegrams fall back to the heap, which is counted
+class TelegramPool {
+  public:
+    static void start();
+
+    static TelegramPtr create(const uint8_t   operation,
+                              const uint8_t   src,
+                              const uint8_t   dest,
+                              const uint16_t  type_id,
+                              const uint8_t   offset,
+                              const uint8_t * message_data,
+                              const uint8_t   message_length);
+
+    static void release(Telegram * telegram);
+
+    static uint16_t size() {
+        return slots_ ? MAX_POOLED_TELEGRAMS : 0;
+    }
+
+    static uint16_t in_use();
+
+    static uint32_t fallback_count() {
+        return fallback_count_;
+    }
+
+  private:
+    static constexpr uint8_t POOL_WORDS = (MAX_POOLED_TELEGRAMS + 31) / 32;
+
+    struct Slot {
+        alignas(Telegram) uint8_t data_[sizeof(Telegram)];
+    };
+
+    static int16_t acquire();
+
+    static Slot *                slots_;            // allocated once and never freed, handles may outlive static destruction
+    static std::atomic<uint32_t> used_[POOL_WORDS]; // one bit per slot, set when in use
+    static std::atomic<uint32_t> fallback_count_;   // # telegrams allocated from the heap
 };
 
 class EMSbus {
@@ -232,6 +331,13 @@ class EMSbus {
 
     static uint8_t calculate_crc(const uint8_t * data, const uint8_t length);
 
+    // bus timing, shown with 'show ems' and in the system info
+    static Histogram poll_to_send_;  // us from a poll to us until our telegram is sent
+    static Histogram tx_to_reply_;   // us from sending a read or write until the reply or ack
+    static Histogram write_to_ack_;  // ms from queuing a write until it is acknowledged, including the retries
+    static Histogram tx_retries_;    // retries per telegram, the last bucket are the ones given up
+    static Histogram rx_queue_time_; // us a received telegram waits in the Rx queue until it is decoded
+
   private:
     static constexpr uint32_t EMS_BUS_TIMEOUT = 30000; // timeout in ms before recognizing the ems bus is offline (30 seconds)
 
@@ -250,7 +356,8 @@ class RxService : public EMSbus {
     ~RxService() = default;
 
     void loop();
-    void add(uint8_t * data, uint8_t length);
+    void push(const uint8_t * data, const uint8_t length);
+    void add(const uint8_t * data, const uint8_t length);
     void add_empty(const uint8_t src, const uint8_t dst, const uint16_t type_id, uint8_t offset);
 
     uint32_t telegram_count() const {
@@ -265,6 +372,14 @@ class RxService : public EMSbus {
         return telegram_error_count_;
     }
 
+    uint32_t frame_overflow_count() const {
+        return frame_overflow_count_;
+    }
+
+    size_t frames_pending() const {
+        return rx_frames_.size();
+    }
+
     // returns a %
     uint8_t quality() const {
         if (telegram_error_count_ == 0) {
@@ -274,32 +389,32 @@ class RxService : public EMSbus {
         return (q <= EMS_BUS_QUALITY_RX_THRESHOLD ? 100 : 100 - q);
     }
 
-    struct QueuedRxTelegram {
-      public:
-        const uint16_t                        id_;
-        const std::shared_ptr<const Telegram> telegram_;
-
-        ~QueuedRxTelegram() = default;
-        // removed && from telegram in 3.7.0-dev.43
-        QueuedRxTelegram(uint16_t id, std::shared_ptr<Telegram> telegram)
-            : id_(id)
-            , telegram_(std::move(telegram)) {
-        }
+    // a raw frame from the UART task, decoded later by the main loop
+    // an empty telegram (see add_empty()) has length 0 and src, dest, type_id (2 bytes) and offset in data
+    struct RxFrame {
+        uint32_t timestamp_; // micros() when received
+        uint8_t  length_;    // including the CRC
+        uint8_t  data_[EMS_MAX_TELEGRAM_LENGTH];
     };
 
-    std::deque<QueuedRxTelegram, AllocatorPSRAM<QueuedRxTelegram>> queue() const {
-        return rx_telegrams_;
+    // the n-th raw frame waiting to be decoded, only valid for n < frames_pending()
+    const RxFrame & pending_frame(size_t n) const {
+        return rx_frames_.peek(n);
     }
 
   private:
     static constexpr uint8_t EMS_BUS_QUALITY_RX_THRESHOLD = 5; // % threshold before reporting quality issues
 
-    uint8_t                         rx_telegram_id_       = 0; // queue counter
-    uint32_t                        telegram_count_       = 0; // # Rx received
-    uint32_t                        telegram_error_count_ = 0; // # Rx CRC errors
-    std::shared_ptr<const Telegram> rx_telegram;               // the incoming Rx telegram
+    void decode(const RxFrame & frame);
+    void process(const TelegramPtr & telegram);
 
-    std::deque<QueuedRxTelegram, AllocatorPSRAM<QueuedRxTelegram>> rx_telegrams_; // the Rx Queue
+    uint32_t telegram_count_       = 0; // # Rx received
+    uint32_t telegram_error_count_ = 0; // # Rx CRC errors
+
+    std::atomic<uint32_t> frame_overflow_count_{0}; // # raw frames dropped because the ring was full, written by the UART task
+    uint32_t              frame_overflow_logged_ = 0;
+
+    RingBuffer<RxFrame, MAX_RX_FRAMES> rx_frames_; // raw frames from the UART task, the Rx queue
 };
 
 class TxService : public EMSbus {
@@ -338,6 +453,19 @@ class TxService : public EMSbus {
         retry_count_ = 0;
     }
 
+    // a reply or ack for the last Tx came in, add its timing to the histograms
+    void tx_replied() {
+        tx_to_reply_.add(::micros() - telegram_last_sent_);
+        tx_retries_.add(retry_count_);
+        if (telegram_last_->operation == Telegram::Operation::TX_WRITE) {
+            write_to_ack_.add(::millis() - telegram_last_queued_);
+        }
+    }
+
+    uint32_t telegram_last_sent() const {
+        return telegram_last_sent_;
+    }
+
     void set_post_send_query(uint16_t type_id) {
         telegram_last_post_send_query_ = type_id;
     }
@@ -404,23 +532,37 @@ class TxService : public EMSbus {
         telegram_write_fail_count_++;
     }
 
+    // the Tx queue is sorted by priority, first in first out for the same priority
+    enum TxPriority : uint8_t {
+        TX_PRIORITY_URGENT,   // retries and the next part of a read in progress
+        TX_PRIORITY_USER,     // writes and raw telegrams
+        TX_PRIORITY_VALIDATE, // reads added to the front, like the read back after a write
+        TX_PRIORITY_FETCH     // all other reads, like the scheduled fetches
+    };
+
     struct QueuedTxTelegram {
-        const uint16_t                        id_;
-        const std::shared_ptr<const Telegram> telegram_;
-        const bool                            retry_; // true if its a retry
-        const uint16_t                        validateid_;
-
-        ~QueuedTxTelegram() = default;
-        // replaced && im std::shared_ptr<Telegram> telegram in 3.7.0-dev.43
-        QueuedTxTelegram(uint16_t id, std::shared_ptr<Telegram> telegram, bool retry, uint16_t validateid)
+        uint16_t    id_;
+        TelegramPtr telegram_;
+        bool        retry_; // true if its a retry
+        uint16_t    validateid_;
+        uint8_t     priority_; // TxPriority
+        uint32_t    queued_;   // millis() when first queued, kept for the retries
+
+        // movable, the queue inserts by priority
+        ~QueuedTxTelegram()                               = default;
+        QueuedTxTelegram(QueuedTxTelegram &&)             = default;
+        QueuedTxTelegram & operator=(QueuedTxTelegram &&) = default;
+        QueuedTxTelegram(uint16_t id, TelegramPtr && telegram, bool retry, uint16_t validateid, uint8_t priority, uint32_t queued)
             : id_(id)
             , telegram_(std::move(telegram))
             , retry_(retry)
-            , validateid_(validateid) {
+            , validateid_(validateid)
+            , priority_(priority)
+            , queued_(queued) {
         }
     };
 
-    std::deque<QueuedTxTelegram, AllocatorPSRAM<QueuedTxTelegram>> queue() const {
+    const std::deque<QueuedTxTelegram, AllocatorPSRAM<QueuedTxTelegram>> & queue() const {
         return tx_telegrams_;
     }
 
@@ -439,14 +581,17 @@ class TxService : public EMSbus {
     uint32_t telegram_read_fail_count_  = 0; // # Tx unsuccessful transmits
     uint32_t telegram_write_fail_count_ = 0; // # Tx unsuccessful transmits
 
-    std::shared_ptr<Telegram> telegram_last_;
-    uint16_t                  telegram_last_post_send_query_; // which type ID to query after a successful send, to read back the values just written
-    uint8_t                   retry_count_  = 0;              // count for # Tx retries
-    uint32_t                  delayed_send_ = 0;              // manage delay for post send query
+    TelegramPtr telegram_last_;
+    uint16_t    telegram_last_post_send_query_; // which type ID to query after a successful send, to read back the values just written
+    uint8_t     retry_count_          = 0;      // count for # Tx retries
+    uint32_t    delayed_send_         = 0;      // manage delay for post send query
+    uint32_t    telegram_last_sent_   = 0;      // micros() when the last Tx was sent
+    uint32_t    telegram_last_queued_ = 0;      // millis() when the last Tx was first queued
 
     uint8_t tx_telegram_id_ = 0; // queue counter
 
     void send_telegram(const QueuedTxTelegram & tx_telegram);
+    void queue_telegram(TelegramPtr && telegram, const uint16_t validateid, const uint8_t priority);
 };
 
 } // namespace emsesp
@@ -370,7 +370,7 @@ bool TemperatureSensor::update(const char * id, const char * name, int16_t offse
 
 // check to see if values have been updated
 bool TemperatureSensor::updated_values() {
-    if (changed_ && Mqtt::publish_queued() == 0) {
+    if (changed_ && Mqtt::publish_queued(Mqtt::PRIORITY_DEVICE) == 0) {
         changed_ = false;
         return true;
     }
@@ -445,9 +445,11 @@ void TemperatureSensor::publish_sensor(const Sensor & sensor) {
         char payload[10];
         Mqtt::queue_publish(topic, Helpers::render_value(payload, sensor.temperature_c, 10, EMSESP::system_.fahrenheit() ? 2 : 0));
     }
-    char cmd[COMMAND_MAX_LENGTH];
-    snprintf(cmd, sizeof(cmd), "%s/%s", F_(temperaturesensor), sensor.name());
-    EMSESP::webSchedulerService.onChange(cmd);
+    if (EMSESP::webSchedulerService.watches(EMSdevice::DeviceType::TEMPERATURESENSOR)) {
+        char cmd[COMMAND_MAX_LENGTH];
+        snprintf(cmd, sizeof(cmd), "%s/%s", F_(temperaturesensor), sensor.name());
+        EMSESP::webSchedulerService.onChange(cmd);
+    }
 }
 
 // send empty config topic to remove the entry from HA
@@ -33,7 +33,7 @@ Alert::Alert(uint8_t device_type, uint8_t device_id, uint8_t product_id, const c
     register_device_value(DeviceValueTAG::TAG_DEVICE_DATA, &setBurnPow_, DeviceValueType::UINT8, FL_(setBurnPow), DeviceValueUOM::PERCENT);
 }
 // UBASetPoint 0x1A
-void Alert::process_UBASetPoints(std::shared_ptr<const Telegram> telegram) {
+void Alert::process_UBASetPoints(const Telegram & telegram) {
     has_update(telegram, setFlowTemp_, 0); // boiler set temp from thermostat
     has_update(telegram, setBurnPow_, 1);  // max burner power in %
 }
@@ -1273,18 +1273,18 @@ void Boiler::check_active() {
 // 0x04
 //  boiler(0x08) -W-> Me(0x0B), ?(0x04), data: 13 96 09 81 00 64 64 35 05 64 5A 22 00 00 00 00 00 00 00 00 B7
 // offset 4 - nominal Power kW, could be zero, 5 - min. Burner, 6 - max. Burner
-void Boiler::process_UBAFactory(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAFactory(const Telegram & telegram) {
     // check for all wanted info in telegram
-    if (telegram->offset > 4 || telegram->offset + telegram->message_length < 7) {
+    if (telegram.offset > 4 || telegram.offset + telegram.message_length < 7) {
         return;
     }
-    toggle_fetch(telegram->type_id, false); // only read once
+    toggle_fetch(telegram.type_id, false); // only read once
     uint8_t min      = 0;
     uint8_t max      = 0;
     uint8_t nomPower = 0;
-    telegram->read_value(nomPower, 4);
-    telegram->read_value(min, 5);
-    telegram->read_value(max, 6);
+    telegram.read_value(nomPower, 4);
+    telegram.read_value(min, 5);
+    telegram.read_value(max, 6);
     // set the value only if no nvs-value is set
     if (nomPower > 0 && nomPower_ == 0) {
         has_update(nomPower_, nomPower);
@@ -1298,7 +1298,7 @@ void Boiler::process_UBAFactory(std::shared_ptr<const Telegram> telegram) {
 }
 
 // 0x18
-void Boiler::process_UBAMonitorFast(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorFast(const Telegram & telegram) {
     has_update(telegram, selFlowTemp_, 0);
     has_update(telegram, curFlowTemp_, 1);
     // has_update(telegram, selBurnPow_, 3); // burn power max setting
@@ -1325,24 +1325,24 @@ void Boiler::process_UBAMonitorFast(std::shared_ptr<const Telegram> telegram) {
     has_update(telegram, sysPress_, 17); // is *10
 
     // read the service code / installation status as appears on the display
-    if ((telegram->message_length > 18) && (telegram->offset == 0)) {
+    if ((telegram.message_length > 18) && (telegram.offset == 0)) {
         char serviceCode[4];
-        telegram->read_value(serviceCode[0], 18);
+        telegram.read_value(serviceCode[0], 18);
         // 0xF0 for 3 stacked horizontal lines like greek capital Xi
         // serviceCode[0] = (serviceCode[0] == (char)0xF0) ? '~' : serviceCode[0];
-        telegram->read_value(serviceCode[1], 19);
+        telegram.read_value(serviceCode[1], 19);
         serviceCode[2] = '\0'; // null terminate string
         has_update(serviceCode_, serviceCode, sizeof(serviceCode_));
     }
 
     has_update(telegram, serviceCodeNumber_, 20);
 
-    if (telegram->offset <= 3 && telegram->offset + telegram->message_length > 7) {
+    if (telegram.offset <= 3 && telegram.offset + telegram.message_length > 7) {
         // some boiler only switch burnGas and have no other burner values, https://github.com/emsesp/EMS-ESP32/discussions/1483
         uint8_t selBurnPow = selBurnPow_;
         uint8_t curBurnPow = curBurnPow_;
-        telegram->read_value(selBurnPow, 3);
-        telegram->read_value(curBurnPow, 4);
+        telegram.read_value(selBurnPow, 3);
+        telegram.read_value(curBurnPow, 4);
         if (burnGas_ && selBurnPow == 0 && curBurnPow == 0) {
             boilerState_ |= 0x08; // set flame signal
             curBurnPow = 100;
@@ -1360,10 +1360,10 @@ void Boiler::process_UBAMonitorFast(std::shared_ptr<const Telegram> telegram) {
  * UBATotalUptime - type 0x14 - total uptime
  * received only after requested (not broadcasted)
  */
-void Boiler::process_UBATotalUptime(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBATotalUptime(const Telegram & telegram) {
     has_update(telegram, UBAuptime_, 0, 3); // force to 3 bytes
     // if broadcasted there is no need to fetch
-    if (telegram->dest == 0) {
+    if (telegram.dest == 0) {
         toggle_fetch(0x14, false);
     }
 }
@@ -1372,7 +1372,7 @@ void Boiler::process_UBATotalUptime(std::shared_ptr<const Telegram> telegram) {
  * UBAParameters - type 0x16
  * data: FF 5A 64 00 0A FA 0F 02 06 64 64 02 08 F8 0F 0F 0F 0F 1E 05 04 09 09 00 28 00 3C
  */
-void Boiler::process_UBAParameters(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAParameters(const Telegram & telegram) {
     has_update(telegram, heatingActivated_, 0);
     has_update(telegram, heatingTemp_, 1);
     has_update(telegram, burnMaxPower_, 2);
@@ -1394,13 +1394,13 @@ void Boiler::process_UBAParameters(std::shared_ptr<const Telegram> telegram) {
  * UBASettingsWW - type 0x26 - max power on offset 7, https://github.com/emsesp/EMS-ESP/issues/740
  * Boiler(0x08) -> Me(0x0B), ?(0x26), data: 01 05 00 0F 00 1E 58 5A
  */
-void Boiler::process_UBASettingsWW(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBASettingsWW(const Telegram & telegram) {
     has_update(telegram, wwMaxPower_, 10);
 }
 
 // 0x33
 //  Boiler(0x08) -> Me(0x0B), UBAParameterWW(0x33), data: 08 FF 30 FB FF 28 FF 07 46 00 00
-void Boiler::process_UBAParameterWW(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAParameterWW(const Telegram & telegram) {
     // has_bitupdate(telegram, wwEquipt_,0,3);  //  8=boiler has ww
     has_update(telegram, wwActivated_, 1); // 0xFF means on
     has_update(telegram, wwSelTemp_, 2);
@@ -1413,7 +1413,7 @@ void Boiler::process_UBAParameterWW(std::shared_ptr<const Telegram> telegram) {
     has_bitupdate(telegram, wwChargeType_, 10, 0); // 0 = charge pump, 0xff = 3-way valve
 
     uint8_t wwComfort = EMS_VALUE_UINT8_NOTSET;
-    if (telegram->read_value(wwComfort, 9)) {
+    if (telegram.read_value(wwComfort, 9)) {
         if (wwComfort == 0) {
             wwComfort = 0; // Hot
         } else if (wwComfort == 0xD8) {
@@ -1432,7 +1432,7 @@ void Boiler::process_UBAParameterWW(std::shared_ptr<const Telegram> telegram) {
  * received every 10 seconds
  * Boiler(0x08) -> Me(0x0B), UBAMonitorWW(0x34), data: 30 01 BA 7D 00 21 00 00 03 00 01 22 2B 00 19 5B
 */
-void Boiler::process_UBAMonitorWW(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorWW(const Telegram & telegram) {
     has_update(telegram, wwSetTemp_, 0);
     has_update(telegram, wwCurTemp_, 1);
     has_update(telegram, wwCurTemp2_, 3);
@@ -1459,7 +1459,7 @@ void Boiler::process_UBAMonitorWW(std::shared_ptr<const Telegram> telegram) {
 + * GB125/Logamatic MC110: issue #650: add retTemp & sysPress
 + * 08 00 E4 00 10 20 2D 48 00 C8 38 02 37 3C 27 03 00 00 00 00 00 01 7B 01 8F 11 00 02 37 80 00 02 1B 80 00 7F FF 80 00
  */
-void Boiler::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorFastPlus(const Telegram & telegram) {
     has_update(telegram, selFlowTemp_, 6);
     has_bitupdate(telegram, burnGas_, 11, 0);
     //has_bitupdate(telegram, heatingPump_, 11, 1); // heating active? see SlowPlus
@@ -1469,13 +1469,13 @@ void Boiler::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram
     has_update(telegram, curFlowTemp_, 7);
     has_update(telegram, flameCurr_, 19);
     uint16_t rettemp = retTemp_;
-    telegram->read_value(rettemp, 17); // 0 means no sensor, HIU read it in 0x779
+    telegram.read_value(rettemp, 17); // 0 means no sensor, HIU read it in 0x779
     if (rettemp != 0 && rettemp != 0x8000) {
         has_update(retTemp_, rettemp);
     }
 
     uint8_t syspress = sysPress_;
-    telegram->read_value(syspress, 21); // 0 means no sensor
+    telegram.read_value(syspress, 21); // 0 means no sensor
     if (syspress == 0) {
         syspress = EMS_VALUE_UINT8_NOTSET;
     }
@@ -1485,20 +1485,20 @@ void Boiler::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram
     has_update(telegram, heatblock_, 23);  // see #1317
     has_update(telegram, headertemp_, 25); // see #1317
     //has_update(telegram, temperatur_, 27); // unknown temperature
-    telegram->read_value(exhaustTemp1_, 31);
+    telegram.read_value(exhaustTemp1_, 31);
     if (Helpers::hasValue(exhaustTemp1_)) {
         has_update(exhaustTemp_, exhaustTemp1_);
     }
     has_update(telegram, pc0Flow_, 36); // see https://github.com/emsesp/EMS-ESP32/issues/2001
 
     // read 3 char service code / installation status as appears on the display
-    if ((telegram->message_length > 3) && (telegram->offset == 0)) {
+    if ((telegram.message_length > 3) && (telegram.offset == 0)) {
         char serviceCode[4] = {0};
-        telegram->read_value(serviceCode[0], 1);
+        telegram.read_value(serviceCode[0], 1);
         // serviceCode[0] = (serviceCode[0] == (char)0xF0) ? '~' : serviceCode[0];
-        telegram->read_value(serviceCode[1], 2);
+        telegram.read_value(serviceCode[1], 2);
         // serviceCode[1] = (serviceCode[1] == (char)0xF0) ? '~' : serviceCode[1];
-        telegram->read_value(serviceCode[2], 3);
+        telegram.read_value(serviceCode[2], 3);
         serviceCode[3] = '\0';
         has_update(serviceCode_, serviceCode, sizeof(serviceCode_));
     }
@@ -1507,13 +1507,13 @@ void Boiler::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram
 
     // at this point do a quick check to see if the hot water or heating is active
     uint8_t state = EMS_VALUE_UINT8_NOTSET;
-    if (telegram->read_value(state, 11) && model() != EMSdevice::EMS_DEVICE_FLAG_HIU && !isHeatPump()) {
+    if (telegram.read_value(state, 11) && model() != EMSdevice::EMS_DEVICE_FLAG_HIU && !isHeatPump()) {
         boilerState_ = state & 0x01 ? 0x08 : 0;  // burnGas
         boilerState_ |= state & 0x02 ? 0x01 : 0; // heatingPump
         boilerState_ |= state & 0x04 ? 0x02 : 0; // 3-way-valve
     }
 
-    if (telegram->offset <= 10 && telegram->offset + telegram->message_length > 11) {
+    if (telegram.offset <= 10 && telegram.offset + telegram.message_length > 11) {
         check_active(); // do a quick check to see if the hot water or heating is active
     }
 }
@@ -1525,7 +1525,7 @@ void Boiler::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram
  *      08 0B 19 00 FF EA 02 47 80 00 00 00 00 62 03 CA 24 2C D6 23 00 00 00 27 4A B6 03 6E 43
  *                  00 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15 16 17 17 19 20 21 22 23 24
  */
-void Boiler::process_UBAMonitorSlow(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorSlow(const Telegram & telegram) {
     has_update(telegram, outdoorTemp_, 0);
     has_update(telegram, boilTemp_, 2);
     has_update(telegram, exhaustTemp_, 4);
@@ -1544,16 +1544,16 @@ void Boiler::process_UBAMonitorSlow(std::shared_ptr<const Telegram> telegram) {
  * https://github.com/Th3M3/buderus_ems-wiki/blob/master/Quelle_08.md
  * https://github.com/emsesp/EMS-ESP32/issues/908
  */
-void Boiler::process_UBAMonitorSlowPlus2(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorSlowPlus2(const Telegram & telegram) {
     has_update(telegram, absBurnPow_, 13); // current burner absolute power (percent of rating plate power)
     if (model() == EMSdevice::EMS_DEVICE_FLAG_HIU) {
         uint8_t state = EMS_VALUE_UINT8_NOTSET;
         boilerState_  = 0;
-        if (telegram->read_value(state, 2)) {
+        if (telegram.read_value(state, 2)) {
             boilerState_ |= state == 1 ? 0x09 : 0; // heating 0/1
         }
         state = EMS_VALUE_UINT8_NOTSET;
-        if (telegram->read_value(state, 5)) {
+        if (telegram.read_value(state, 5)) {
             boilerState_ |= state == 1 ? 0x0A : 0; // dhw 0/1
         }
         check_active(); // do a quick check to see if the hot water or heating is active
@@ -1565,7 +1565,7 @@ void Boiler::process_UBAMonitorSlowPlus2(std::shared_ptr<const Telegram> telegra
  * Boiler(0x08) -> Me(0x0B), UBAMonitorSlowPlus(0xE5),
  * data: 01 00 20 00 00 78 00 00 00 00 00 1E EB 00 9D 3E 00 00 00 00 6B 5E 00 06 4C 64 00 00 00 00 8A A3
  */
-void Boiler::process_UBAMonitorSlowPlus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorSlowPlus(const Telegram & telegram) {
     has_bitupdate(telegram, fanWork_, 2, 2);
     has_bitupdate(telegram, ignWork_, 2, 3);
     has_bitupdate(telegram, heatingPump_, 2, 5);
@@ -1591,7 +1591,7 @@ void Boiler::process_UBAMonitorSlowPlus(std::shared_ptr<const Telegram> telegram
  * from: issue #732
  *       data: 01 50 1E 5A 46 12 64 00 06 FA 3C 03 05 64 00 00 00 28 00 41 03 00 00 00 00 00 00 00 00 00
  */
-void Boiler::process_UBAParametersPlus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAParametersPlus(const Telegram & telegram) {
     has_update(telegram, heatingActivated_, 0);
     has_update(telegram, heatingTemp_, 1);
     has_update(telegram, burnMaxPower_, 4);
@@ -1611,7 +1611,7 @@ void Boiler::process_UBAParametersPlus(std::shared_ptr<const Telegram> telegram)
 
 // 0xEA
 // Boiler(0x08) -> (0x0B), (0xEA), data: 00 00 00 00 00 00 3C FB 00 28 00 02 46 00 00 00 3C 3C 28
-void Boiler::process_UBAParameterWWPlus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAParameterWWPlus(const Telegram & telegram) {
     has_update(telegram, wwSelTempOff_, 0); // confusing description in #96
     has_update(telegram, wwActivated_, 5);  // 0x01 means on
     has_update(telegram, wwSelTemp_, 6);    // setting here
@@ -1628,11 +1628,11 @@ void Boiler::process_UBAParameterWWPlus(std::shared_ptr<const Telegram> telegram
     has_update(telegram, wwChargeOptimization_, 25);
     has_update(telegram, wwSelTempEcoplus_, 27);
 
-    telegram->read_value(wwComfort2_, 26);
+    telegram.read_value(wwComfort2_, 26);
     uint8_t wwComfort1 = EMS_VALUE_UINT8_NOTSET;
     if (Helpers::hasValue(wwComfort2_)) {
         has_update(wwComfort1_, wwComfort2_);
-    } else if (telegram->read_value(wwComfort1, 13)) {
+    } else if (telegram.read_value(wwComfort1, 13)) {
         if (wwComfort1 == 0) {
             wwComfort1 = 0; // High_Comfort
         } else if (wwComfort1 == 0xD8) {
@@ -1646,7 +1646,7 @@ void Boiler::process_UBAParameterWWPlus(std::shared_ptr<const Telegram> telegram
 
 // 0xE9 - WW monitor ems+
 // e.g. 08 00 E9 00 37 01 F6 01 ED 00 00 00 00 41 3C 00 00 00 00 00 00 00 00 00 00 00 00 37 00 00 00 (CRC=77) #data=27
-void Boiler::process_UBAMonitorWWPlus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMonitorWWPlus(const Telegram & telegram) {
     has_update(telegram, wwSetTemp_, 0);
     has_update(telegram, wwCurTemp_, 1);
     has_update(telegram, wwCurTemp2_, 3);
@@ -1678,7 +1678,7 @@ void Boiler::process_UBAMonitorWWPlus(std::shared_ptr<const Telegram> telegram)
  * 08 00 FF 48 03 95 00 00 01 15 00 00 00 00 00 00 00 F9 29 00
  *
  */
-void Boiler::process_UBAInformation(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAInformation(const Telegram & telegram) {
     has_update(telegram, upTimeControl_, 0);
     has_update(telegram, upTimeCompHeating_, 8);
     has_update(telegram, upTimeCompCooling_, 16);
@@ -1712,7 +1712,7 @@ void Boiler::process_UBAInformation(std::shared_ptr<const Telegram> telegram) {
  * 08 00 FF 18 03 94 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 00 00 00 00 00 00 7E
  * 08 00 FF 31 03 94 00 00 00 00 00 00 00 38
  */
-void Boiler::process_UBAEnergySupplied(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAEnergySupplied(const Telegram & telegram) {
     has_update(telegram, upTimeTotal_, 0);
     has_update(telegram, nrgSuppTotal_, 4);
     has_update(telegram, nrgSuppHeating_, 12);
@@ -1725,7 +1725,7 @@ void Boiler::process_UBAEnergySupplied(std::shared_ptr<const Telegram> telegram)
 //08 00 FF 00 03 8D 03 00 10 30 10 60 00 04 00 00 00 17 00 00 00 3C 38 0E 64 00 00 0C 33 C7 00
 //XR1A050001   A05 Pump Heat circuit (1.0 ) 1 >> 1 & 0x01 ?
 //XR1A040001   A04 Pump Cold circuit (1.0 ) 1 & 0x1 ?
-void Boiler::process_HpPower(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPower(const Telegram & telegram) {
     has_bitupdate(telegram, VC0valve_, 0, 7);
     has_bitupdate(telegram, hp3wayValve_, 0, 6);
     // has_bitupdate(telegram, heating_, 0, 0); // heating on? https://github.com/emsesp/EMS-ESP32/discussions/1898
@@ -1764,7 +1764,7 @@ void Boiler::process_HpPower(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Heatpump temperatures - type 0x48F
-void Boiler::process_HpTemperatures(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpTemperatures(const Telegram & telegram) {
     has_update(telegram, hpTc0_, 6);
     has_update(telegram, hpTc1_, 4);
     has_update(telegram, hpTc3_, 2);
@@ -1785,7 +1785,7 @@ void Boiler::process_HpTemperatures(std::shared_ptr<const Telegram> telegram) {
 
 // Heatpump pool unit - type 0x48A
 // 08 00 FF 00 03 8A 01 4C 01 0C 00 00 0A 00 1E 00 00 01 00 04 4A 00
-void Boiler::process_HpPool(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPool(const Telegram & telegram) {
     has_update(telegram, poolSetTemp_, 1);
 }
 
@@ -1793,25 +1793,25 @@ void Boiler::process_HpPool(std::shared_ptr<const Telegram> telegram) {
 // Boiler(0x08) -> All(0x00), ?(0x04A2), data: 02 01 01 00 01 00
 // Boiler(0x08) -W-> Me(0x0B), HpInput(0x04A2), data: 20 07 06 01 00 (from #802)
 // see https://github.com/emsesp/EMS-ESP32/issues/2844#issuecomment-3689049155
-void Boiler::process_HpInput(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpInput(const Telegram & telegram) {
 }
 
 // Heatpump inputs settings- type 0x486 (https://github.com/emsesp/EMS-ESP32/issues/600)
 // Boiler(0x08) -> All(0x00), ?(0x0486), data: 01 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00
 // Boiler(0x08) -> All(0x00), ?(0x0486), data: 01 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 00 00 00 00 00 (offset 25)
 // Boiler(0x08) -> All(0x00), ?(0x0486), data: 00 00 (offset 51)
-void Boiler::process_HpInConfig(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpInConfig(const Telegram & telegram) {
     char option[16];
     // inputs 1,2,3 <inv>[<evu1><evu2><evu3><comp><aux><cool><heat><dhw><pv><prot><pres><mod>]
     uint8_t index[] = {0, 3, 6, 9, 12, 15, 18, 21, 24, 39, 36, 30, 27};
     for (uint8_t i = 0; i < 3; i++) {
         for (uint8_t j = 0; j < 12; j++) {
             option[j] = hpInput[i].option[j] - '0';
-            telegram->read_value(option[j], index[j] + i);
+            telegram.read_value(option[j], index[j] + i);
             option[j] = option[j] == 1 ? '1' : '0';
         }
         option[12] = atoi(&hpInput[i].option[12]);
-        telegram->read_value(option[12], 27 + i); // modulation
+        telegram.read_value(option[12], 27 + i); // modulation
         Helpers::smallitoa(&option[12], (uint16_t)option[12]);
         has_update(hpInput[i].option, option, 16);
     }
@@ -1819,22 +1819,22 @@ void Boiler::process_HpInConfig(std::shared_ptr<const Telegram> telegram) {
     uint8_t index4[] = {42, 43, 44, 45, 46, 47, 52, 50, 49, 48};
     for (uint8_t j = 0; j < 9; j++) {
         option[j] = hpInput[3].option[j] - '0';
-        telegram->read_value(option[j], index4[j]);
+        telegram.read_value(option[j], index4[j]);
         option[j] = option[j] == 1 ? '1' : '0';
     }
     option[9] = atoi(&hpInput[3].option[9]);
-    telegram->read_value(option[9], 48); // modulation
+    telegram.read_value(option[9], 48); // modulation
     Helpers::smallitoa(&option[9], (uint16_t)option[9]);
     has_update(hpInput[3].option, option, 13);
 }
 
 // Boiler(0x08) -W-> Me(0x0B), HpHeaterConfig(0x0485)
-void Boiler::process_HpCooling(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpCooling(const Telegram & telegram) {
     has_update(telegram, pvCooling_, 21);
 }
 
 // Boiler(0x08) -W-> Me(0x0B), HpHeaterConfig(0x0492), data: 03 00 00 04 00
-void Boiler::process_HpHeaterConfig(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpHeaterConfig(const Telegram & telegram) {
     if (model() == EMSdevice::EMS_DEVICE_FLAG_CS6800) {
         has_enumupdate(telegram, maxHeatComp_, 2, {0, 2, 4, 5});
         has_enumupdate(telegram, maxHeatHeat_, 3, {2, 4, 5});
@@ -1849,7 +1849,7 @@ void Boiler::process_HpHeaterConfig(std::shared_ptr<const Telegram> telegram) {
 // 0x2A - MC110Status
 // e.g. 88 00 2A 00 00 00 00 00 00 00 00 00 D2 00 00 80 00 00 01 08 80 00 02 47 00
 // see https://github.com/emsesp/EMS-ESP/issues/397
-void Boiler::process_MC110Status(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_MC110Status(const Telegram & telegram) {
     has_update(telegram, wwMixerTemp_, 14);
     has_update(telegram, wwCylMiddleTemp_, 18);
 }
@@ -1857,51 +1857,51 @@ void Boiler::process_MC110Status(std::shared_ptr<const Telegram> telegram) {
 /*
  * UBAOutdoorTemp - type 0xD1 - external temperature EMS+
  */
-void Boiler::process_UBAOutdoorTemp(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAOutdoorTemp(const Telegram & telegram) {
     has_update(telegram, outdoorTemp_, 0);
 }
 
 // UBASetPoint 0x1A
-void Boiler::process_UBASetPoints(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBASetPoints(const Telegram & telegram) {
     uint8_t setFlowTemp_ = 0;
     uint8_t setBurnPow_  = 0;
     uint8_t setPumpMod_  = 0;
-    telegram->read_value(setFlowTemp_, 0);
-    telegram->read_value(setBurnPow_, 1);
-    telegram->read_value(setPumpMod_, 2);
+    telegram.read_value(setFlowTemp_, 0);
+    telegram.read_value(setBurnPow_, 1);
+    telegram.read_value(setPumpMod_, 2);
 
     // forceHeatingOff overwrite to zero
-    if (forceHeatingOff_ == EMS_VALUE_BOOL_ON && telegram->dest == 0x08 && (setFlowTemp_ + setBurnPow_ + setPumpMod_) != 0) {
+    if (forceHeatingOff_ == EMS_VALUE_BOOL_ON && telegram.dest == 0x08 && (setFlowTemp_ + setBurnPow_ + setPumpMod_) != 0) {
         uint8_t data[] = {0, 0, 0, 0};
         write_command(EMS_TYPE_UBASetPoints, 0, data, sizeof(data), 0);
     }
 }
 
 // UBASetPoints ems+ 0x2E0
-void Boiler::process_UBASetPoints2(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBASetPoints2(const Telegram & telegram) {
     uint8_t setFlowTemp_ = 0;
     uint8_t setBurnPow_  = 0;
-    telegram->read_value(setFlowTemp_, 0);
-    telegram->read_value(setBurnPow_, 1);
+    telegram.read_value(setFlowTemp_, 0);
+    telegram.read_value(setBurnPow_, 1);
 
     // forceHeatingOff overwrite to zero
-    if (forceHeatingOff_ == EMS_VALUE_BOOL_ON && telegram->dest == 0x08 && (setFlowTemp_ + setBurnPow_) != 0) {
+    if (forceHeatingOff_ == EMS_VALUE_BOOL_ON && telegram.dest == 0x08 && (setFlowTemp_ + setBurnPow_) != 0) {
         uint8_t data[] = {1, 0, 0, 1, 1};
         write_command(EMS_TYPE_UBASetPoints2, 0, data, sizeof(data), 0);
     }
 }
 
 // 0x35 - not yet implemented, not readable, only for settings
-void Boiler::process_UBAFlags(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAFlags(const Telegram & telegram) {
 }
 
 // 0x1C
 // 08 00 1C 94 0B 0A 1D 31 08 00 80 00 00 00 -> message for 29.11.2020
 // 08 00 1C 94 0B 0A 1D 31 00 00 00 00 00 00 -> message reset
-void Boiler::process_UBAMaintenanceStatus(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_UBAMaintenanceStatus(const Telegram & telegram) {
     // 5. byte: Maintenance due (0 = no, 3 = yes, due to operating hours, 8 = yes, due to date)
     uint8_t message_code = maintenanceMessage_[2] - '0';
-    telegram->read_value(message_code, 5);
+    telegram.read_value(message_code, 5);
 
     if (Helpers::hasValue(message_code)) {
         char message[5];
@@ -1911,26 +1911,26 @@ void Boiler::process_UBAMaintenanceStatus(std::shared_ptr<const Telegram> telegr
 }
 
 // 0xBF
-void Boiler::process_ErrorMessage(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_ErrorMessage(const Telegram & telegram) {
     EMSESP::send_read_request(0xC2, device_id(), 0, 20); // read last errorcode
     EMSESP::send_read_request(0xC6, device_id(), 0, 21); // read last errorcode
 }
 
 // 0x10, 0x11
-void Boiler::process_UBAErrorMessage(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 11) {
+void Boiler::process_UBAErrorMessage(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 11) {
         return;
     }
     // data: displaycode(2), errornumber(2), year, month, hour, day, minute, duration(2), src-addr
     static uint32_t lastCodeDate_ = 0; // last code date
-    uint8_t         code[3]       = {telegram->message_data[0], telegram->message_data[1], 0};
-    uint16_t        codeNo        = telegram->message_data[2] * 256 + telegram->message_data[3];
-    uint16_t        year          = (telegram->message_data[4] & 0x7F) + 2000;
-    uint8_t         month         = telegram->message_data[5];
-    uint8_t         day           = telegram->message_data[7];
-    uint8_t         hour          = telegram->message_data[6];
-    uint8_t         min           = telegram->message_data[8];
-    uint16_t        duration      = telegram->message_data[9] * 256 + telegram->message_data[10];
+    uint8_t         code[3]       = {telegram.message_data[0], telegram.message_data[1], 0};
+    uint16_t        codeNo        = telegram.message_data[2] * 256 + telegram.message_data[3];
+    uint16_t        year          = (telegram.message_data[4] & 0x7F) + 2000;
+    uint8_t         month         = telegram.message_data[5];
+    uint8_t         day           = telegram.message_data[7];
+    uint8_t         hour          = telegram.message_data[6];
+    uint8_t         min           = telegram.message_data[8];
+    uint16_t        duration      = telegram.message_data[9] * 256 + telegram.message_data[10];
     uint32_t        date          = (year - 2000) * 535680UL + month * 44640UL + day * 1440UL + hour * 60 + min + duration;
     // check valid https://github.com/emsesp/EMS-ESP32/issues/2189
     if (day == 0 || day > 31 || month == 0 || month > 12 || !std::isprint(code[0]) || !std::isprint(code[1])) {
@@ -1953,37 +1953,37 @@ void Boiler::process_UBAErrorMessage(std::shared_ptr<const Telegram> telegram) {
 
 // 0xC2, without clock in system it stores 3 bytes uptime in 11 and 16, with clock date in 10-14, and 15-19
 // date is marked with 0x80 to year-field
-void Boiler::process_UBAErrorMessage2(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 20) {
+void Boiler::process_UBAErrorMessage2(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 20) {
         return;
     }
 
     uint32_t date                    = 0;
     char     code[sizeof(lastCode_)] = {0};
     uint16_t codeNo                  = EMS_VALUE_INT16_NOTSET;
-    code[0]                          = telegram->message_data[5];
-    code[1]                          = telegram->message_data[6];
-    code[2]                          = telegram->message_data[7];
+    code[0]                          = telegram.message_data[5];
+    code[1]                          = telegram.message_data[6];
+    code[2]                          = telegram.message_data[7];
     code[3]                          = 0;
-    telegram->read_value(codeNo, 8);
+    telegram.read_value(codeNo, 8);
     if (!std::isprint(code[0]) || !std::isprint(code[1]) || !std::isprint(code[2])) {
         return;
     }
 
     // check for valid date, https://github.com/emsesp/EMS-ESP32/issues/204
-    if (telegram->message_data[10] & 0x80) {
-        uint16_t start_year  = (telegram->message_data[10] & 0x7F) + 2000;
-        uint8_t  start_month = telegram->message_data[11];
-        uint8_t  start_day   = telegram->message_data[13];
-        uint8_t  start_hour  = telegram->message_data[12];
-        uint8_t  start_min   = telegram->message_data[14];
-        uint16_t end_year    = (telegram->message_data[15] & 0x7F) + 2000;
-        uint8_t  end_month   = telegram->message_data[16];
-        uint8_t  end_day     = telegram->message_data[18];
-        uint8_t  end_hour    = telegram->message_data[17];
-        uint8_t  end_min     = telegram->message_data[19];
-
-        if (telegram->message_data[15] & 0x80) { //valid end date
+    if (telegram.message_data[10] & 0x80) {
+        uint16_t start_year  = (telegram.message_data[10] & 0x7F) + 2000;
+        uint8_t  start_month = telegram.message_data[11];
+        uint8_t  start_day   = telegram.message_data[13];
+        uint8_t  start_hour  = telegram.message_data[12];
+        uint8_t  start_min   = telegram.message_data[14];
+        uint16_t end_year    = (telegram.message_data[15] & 0x7F) + 2000;
+        uint8_t  end_month   = telegram.message_data[16];
+        uint8_t  end_day     = telegram.message_data[18];
+        uint8_t  end_hour    = telegram.message_data[17];
+        uint8_t  end_min     = telegram.message_data[19];
+
+        if (telegram.message_data[15] & 0x80) { //valid end date
             date = (end_year - 2000) * 535680UL + end_month * 44640UL + end_day * 1440UL + end_hour * 60 + end_min;
             snprintf(&code[3],
                      sizeof(code) - 3,
@@ -2006,8 +2006,8 @@ void Boiler::process_UBAErrorMessage2(std::shared_ptr<const Telegram> telegram)
     } else { // no clock, the uptime is stored https://github.com/emsesp/EMS-ESP32/issues/121
         uint32_t starttime = 0;
         uint32_t endtime   = 0;
-        telegram->read_value(starttime, 11, 3);
-        telegram->read_value(endtime, 16, 3);
+        telegram.read_value(starttime, 11, 3);
+        telegram.read_value(endtime, 16, 3);
         snprintf(&code[3], sizeof(code) - 3, "(%d) @uptime %lu - %lu min", codeNo, starttime, endtime);
         date = starttime;
     }
@@ -2019,37 +2019,37 @@ void Boiler::process_UBAErrorMessage2(std::shared_ptr<const Telegram> telegram)
 
 // C6, C7 https://github.com/emsesp/EMS-ESP32/issues/938#issuecomment-1425813815
 // as C2, but offset shifted one byte
-void Boiler::process_UBAErrorMessage3(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 21) {
+void Boiler::process_UBAErrorMessage3(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 21) {
         return;
     }
 
     uint32_t date                    = 0;
     char     code[sizeof(lastCode_)] = {0};
     uint16_t codeNo                  = EMS_VALUE_INT16_NOTSET;
-    code[0]                          = telegram->message_data[6];
-    code[1]                          = telegram->message_data[7];
-    code[2]                          = telegram->message_data[8];
+    code[0]                          = telegram.message_data[6];
+    code[1]                          = telegram.message_data[7];
+    code[2]                          = telegram.message_data[8];
     code[3]                          = 0;
-    telegram->read_value(codeNo, 9);
+    telegram.read_value(codeNo, 9);
     if (!std::isprint(code[0]) || !std::isprint(code[1]) || !std::isprint(code[2])) {
         return;
     }
 
     // check for valid date, https://github.com/emsesp/EMS-ESP32/issues/204
-    if (telegram->message_data[11] & 0x80) {
-        uint16_t start_year  = (telegram->message_data[11] & 0x7F) + 2000;
-        uint8_t  start_month = telegram->message_data[12];
-        uint8_t  start_day   = telegram->message_data[14];
-        uint8_t  start_hour  = telegram->message_data[13];
-        uint8_t  start_min   = telegram->message_data[15];
-        uint16_t end_year    = (telegram->message_data[16] & 0x7F) + 2000;
-        uint8_t  end_month   = telegram->message_data[17];
-        uint8_t  end_day     = telegram->message_data[19];
-        uint8_t  end_hour    = telegram->message_data[18];
-        uint8_t  end_min     = telegram->message_data[20];
-
-        if (telegram->message_data[16] & 0x80) { //valid end date
+    if (telegram.message_data[11] & 0x80) {
+        uint16_t start_year  = (telegram.message_data[11] & 0x7F) + 2000;
+        uint8_t  start_month = telegram.message_data[12];
+        uint8_t  start_day   = telegram.message_data[14];
+        uint8_t  start_hour  = telegram.message_data[13];
+        uint8_t  start_min   = telegram.message_data[15];
+        uint16_t end_year    = (telegram.message_data[16] & 0x7F) + 2000;
+        uint8_t  end_month   = telegram.message_data[17];
+        uint8_t  end_day     = telegram.message_data[19];
+        uint8_t  end_hour    = telegram.message_data[18];
+        uint8_t  end_min     = telegram.message_data[20];
+
+        if (telegram.message_data[16] & 0x80) { //valid end date
             date = (end_year - 2000) * 535680UL + end_month * 44640UL + end_day * 1440UL + end_hour * 60 + end_min;
             snprintf(&code[3],
                      sizeof(code) - 3,
@@ -2072,8 +2072,8 @@ void Boiler::process_UBAErrorMessage3(std::shared_ptr<const Telegram> telegram)
     } else { // no clock, the uptime is stored https://github.com/emsesp/EMS-ESP32/issues/121
         uint32_t starttime = 0;
         uint32_t endtime   = 0;
-        telegram->read_value(starttime, 12, 3);
-        telegram->read_value(endtime, 17, 3);
+        telegram.read_value(starttime, 12, 3);
+        telegram.read_value(endtime, 17, 3);
         snprintf(&code[3], sizeof(code) - 3, "(%d) @uptime %lu - %lu min", codeNo, starttime, endtime);
         date = starttime;
     }
@@ -2084,8 +2084,8 @@ void Boiler::process_UBAErrorMessage3(std::shared_ptr<const Telegram> telegram)
 }
 
 // 0x15 maintenance data
-void Boiler::process_UBAMaintenanceData(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 5) {
+void Boiler::process_UBAMaintenanceData(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 5) {
         return;
     }
 
@@ -2093,7 +2093,7 @@ void Boiler::process_UBAMaintenanceData(std::shared_ptr<const Telegram> telegram
     has_update(telegram, maintenanceType_, 0); // 0 = off, 1 = by operating hours, 2 = by date, 3 = manual
 
     uint8_t time = (maintenanceTime_ == EMS_VALUE_UINT16_NOTSET) ? EMS_VALUE_UINT8_NOTSET : maintenanceTime_ / 100;
-    telegram->read_value(time, 1);
+    telegram.read_value(time, 1);
     if (Helpers::hasValue(time)) {
         if (time * 100 != maintenanceTime_) {
             maintenanceTime_ = time * 100;
@@ -2102,9 +2102,9 @@ void Boiler::process_UBAMaintenanceData(std::shared_ptr<const Telegram> telegram
     }
 
     // date only
-    uint8_t day   = telegram->message_data[2];
-    uint8_t month = telegram->message_data[3];
-    uint8_t year  = telegram->message_data[4];
+    uint8_t day   = telegram.message_data[2];
+    uint8_t month = telegram.message_data[3];
+    uint8_t year  = telegram.message_data[4];
     if (day > 0 && month > 0) {
         char date[20];
         snprintf(date, sizeof(date), "%02d.%02d.%04d", day, month, year + 2000);
@@ -2114,7 +2114,7 @@ void Boiler::process_UBAMaintenanceData(std::shared_ptr<const Telegram> telegram
 
 // Boiler(0x08) -> All(0x00), ?(0x0484), data: 00 00 14 28 0D 50 00 00 00 02 02 07 28 01 00 02 05 19 0A 0A 03 0D 07 00 0A
 // Boiler(0x08) -> All(0x00), ?(0x0484), data: 01 90 00 F6 28 14 64 00 00 E1 00 1E 00 1E 01 64 01 64 54 20 00 00 (offset 25)
-void Boiler::process_HpSilentMode(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpSilentMode(const Telegram & telegram) {
     has_update(telegram, wwAltOpPrioHeat_, 2); // range 20-120 minutes on Buderus WSW196i
     has_update(telegram, wwAltOpPrioWw_, 3);   // range 30-120 minutes on Buderus WSW196i
     has_update(telegram, silentMode_, 10);     // enum off-auto-on
@@ -2132,7 +2132,7 @@ void Boiler::process_HpSilentMode(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Boiler(0x08) -B-> All(0x00), ?(0x0488), data: 8E 00 00 00 00 00 01 03
-void Boiler::process_HpValve(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpValve(const Telegram & telegram) {
     // has_bitupdate(telegram, auxHeaterStatus_, 0, 2);
     has_update(telegram, auxHeatMixValve_, 7);
     has_update(telegram, pc1Rate_, 13); // percent
@@ -2140,20 +2140,20 @@ void Boiler::process_HpValve(std::shared_ptr<const Telegram> telegram) {
 
 // Boiler(0x08) -B-> All(0x00), ?(0x048B), data: 00 00 0A 1E 4E 00 1E 01 2C 00 01 64 55 05 12 50 50 50 00 00 1E 01 2C 00
 // Boiler(0x08) -B-> All(0x00), ?(0x048B), data: 00 1E 00 96 00 1E (offset 24)
-void Boiler::process_HpPumps(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPumps(const Telegram & telegram) {
     has_update(telegram, tempDiffHeat_, 4); // is * 10
     has_update(telegram, tempDiffCool_, 3); // is * 10
     has_update(telegram, hpPumpMode_, 18);
 }
 
 // 0x02D6, https://github.com/emsesp/EMS-ESP32/issues/2001
-void Boiler::process_HpPump2(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPump2(const Telegram & telegram) {
     has_update(telegram, pc1On_, 0);
     has_update(telegram, pc1Flow_, 9);
 }
 
 // Boiler(0x08) -> All(0x00), ?(0x0491), data: 03 01 00 00 00 02 64 00 00 14 01 2C 00 0A 00 1E 00 1E 00 00 1E 0A 1E 05 05
-void Boiler::process_HpAdditionalHeater(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpAdditionalHeater(const Telegram & telegram) {
     has_update(telegram, auxHeaterSource_, 0); // https://github.com/emsesp/EMS-ESP32/discussions/2489
     has_update(telegram, auxHeaterOnly_, model() == EMSdevice::EMS_DEVICE_FLAG_CS6800 ? 3 : 1);
     has_update(telegram, auxHeaterOff_, 2);
@@ -2166,7 +2166,7 @@ void Boiler::process_HpAdditionalHeater(std::shared_ptr<const Telegram> telegram
 
 // DHW 0x499
 // Boiler(0x08) -B-> All(0x00), ?(0x0499), data: 31 33 3F 3B 01
-void Boiler::process_HpDhwSettings(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpDhwSettings(const Telegram & telegram) {
     has_update(telegram, wwComfOffTemp_, 1);
     has_update(telegram, wwEcoOffTemp_, 0);
     has_update(telegram, wwEcoPlusOffTemp_, 5);
@@ -2182,13 +2182,13 @@ void Boiler::process_HpDhwSettings(std::shared_ptr<const Telegram> telegram) {
 
 // 0x49C:
 // Boiler(0x08) -B-> All(0x00), ?(0x049C), data: 00 00 00 00
-void Boiler::process_HpSettings2(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpSettings2(const Telegram & telegram) {
     has_update(telegram, vp_cooling_, 3);
 }
 
 // 0x49D
 // Boiler(0x08) -B-> All(0x00), ?(0x049D), data: 00 00 00 00 00 00 00 00 00 00 00 00
-void Boiler::process_HpSettings3(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpSettings3(const Telegram & telegram) {
     has_update(telegram, heatCable_, 2);
     // has_update(telegram, VC0valve_, 3); // read in 48D
     has_update(telegram, primePump_, 4);
@@ -2201,7 +2201,7 @@ void Boiler::process_HpSettings3(std::shared_ptr<const Telegram> telegram) {
 
 // boiler(0x08) -W-> Me(0x0B), ?(0x04AE), data: 00 00 BD C4 00 00 5B 6A 00 00 00 24 00 00 62 59 00 00 00 00 00 00 00 00
 // boiler(0x08) -W-> Me(0x0B), ?(0x04AE), data: 00 00 00 00 00 00 00 00 (offset 24)
-void Boiler::process_HpEnergy(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpEnergy(const Telegram & telegram) {
     has_update(telegram, nrgTotal_, 0);
     has_update(telegram, nrgHeat_, 4);
     has_update(telegram, nrgWw_, 12);
@@ -2211,7 +2211,7 @@ void Boiler::process_HpEnergy(std::shared_ptr<const Telegram> telegram) {
 // boiler(0x08) -W-> Me(0x0B), ?(0x04AF), data: 00 00 48 B2 00 00 48 55 00 00 00 5D 00 00 01 78 00 00 00 00 00 00 07 61
 // boiler(0x08) -W-> Me(0x0B), ?(0x04AF), data: 00 00 24 B0 00 00 00 12 00 00 23 A5 00 00 00 4B 00 00 00 00 00 00 00 00 (offset 24)
 // boiler(0x08) -W-> Me(0x0B), ?(0x04AF), data: 00 00 00 00 00 00 00 00 (offset 48)
-void Boiler::process_HpMeters(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpMeters(const Telegram & telegram) {
     has_update(telegram, meterTotal_, 0);
     has_update(telegram, meterComp_, 4);
     has_update(telegram, meterEHeat_, 8);
@@ -2220,28 +2220,28 @@ void Boiler::process_HpMeters(std::shared_ptr<const Telegram> telegram) {
     has_update(telegram, meterCool_, 40);
 }
 
-void Boiler::process_HpPressure(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPressure(const Telegram & telegram) {
     has_update(telegram, wwPrio_, 3);
     has_update(telegram, hpSetDiffPress_, 9);
 }
 
 // boiler(0x08) -W-> Me(0x0B), ?(0x04A5), data: 00 00 3C 1D 09 0A 0A 01 00 28 0A 00 01 00 00
-void Boiler::process_HpFan(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpFan(const Telegram & telegram) {
     has_update(telegram, fan_, 9);
 }
 
 // 0x4AA
-void Boiler::process_HpPower2(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPower2(const Telegram & telegram) {
     has_update(telegram, hpCurrPower_, 0);
 }
 
 // 0x4A7
-void Boiler::process_HpPowerLimit(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HpPowerLimit(const Telegram & telegram) {
     has_update(telegram, hpPowerLimit_, 0);
 }
 
 // Boiler(0x08) -B-> All(0x00), ?(0x2E), data: 00 00 1C CE 00 00 05 E8 00 00 00 18 00 00 00 02
-void Boiler::process_Meters(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_Meters(const Telegram & telegram) {
     has_update(telegram, gasMeterHeat_, 0);
     has_update(telegram, gasMeterWw_, 4);
     has_update(telegram, meterHeat_, 8);
@@ -2249,7 +2249,7 @@ void Boiler::process_Meters(std::shared_ptr<const Telegram> telegram) {
 }
 
 // boiler(0x08) -B-> All(0x00), ?(0x3B), data: 00 00 1B D1 00 00 05 7F
-void Boiler::process_Energy(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_Energy(const Telegram & telegram) {
     has_update(telegram, nrgHeat2_, 0);
     has_update(telegram, nrgWw2_, 4);
 }
@@ -2257,7 +2257,7 @@ void Boiler::process_Energy(std::shared_ptr<const Telegram> telegram) {
 // HIU unit
 
 // boiler(0x08) -B-> All(0x00), ?(0x0779), data: 06 05 01 01 AD 02 EF FF FF 00 00 7F FF
-void Boiler::process_HIUMonitor(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HIUMonitor(const Telegram & telegram) {
     has_update(telegram, retTemp_, 3);     // is * 10
     has_update(telegram, netFlowTemp_, 5); // is * 10
     has_update(telegram, heatValve_, 7);   // is %
@@ -2266,14 +2266,14 @@ void Boiler::process_HIUMonitor(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Boiler(0x08) -W-> ME(0x0x), ?(0x0772), data: 00 00 00 00 00
-void Boiler::process_HIUSettings(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HIUSettings(const Telegram & telegram) {
     has_update(telegram, keepWarmTemp_, 1);
     has_update(telegram, setReturnTemp_, 2);
 }
 
 // Weather compensation, #1642
 // boiler(0x08) -W-> Me(0x0B), ?(0x28), data: 00 3C 32 10 00 05
-void Boiler::process_WeatherComp(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_WeatherComp(const Telegram & telegram) {
     has_update(telegram, curveOn_, 0);
     has_update(telegram, curveEnd_, 1);
     has_update(telegram, curveBase_, 2);
@@ -2308,7 +2308,7 @@ bool Boiler::set_returnTemp(const char * value, const int8_t id) {
  *
 // 0xBB Heatpump optimization
 // Boiler(0x08) -> Me(0x0B), ?(0xBB), data: 00 00 00 00 00 00 00 00 00 00 00 FF 02 0F 1E 0B 1A 00 14 03
-void Boiler::process_HybridHp(std::shared_ptr<const Telegram> telegram) {
+void Boiler::process_HybridHp(const Telegram & telegram) {
     has_enumupdate(telegram, hybridStrategy_, 12, 1); // cost = 2, temperature = 3, mix = 4
     has_update(telegram, switchOverTemp_, 13);      // full degrees
     has_update(telegram, energyCostRatio_, 14);       // is *10
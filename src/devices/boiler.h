@@ -345,64 +345,64 @@ class Boiler : public EMSdevice {
     uint8_t delayBoiler_;     // minutes
     uint8_t tempDiffBoiler_;  // relative temperature degrees
   */
-    void process_UBAFactory(std::shared_ptr<const Telegram> telegram);
-    void process_UBAParameterWW(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorFast(std::shared_ptr<const Telegram> telegram);
-    void process_UBATotalUptime(std::shared_ptr<const Telegram> telegram);
-    void process_UBAParameters(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorWW(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorSlow(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorSlowPlus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorSlowPlus2(std::shared_ptr<const Telegram> telegram);
-    void process_UBAParametersPlus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAParameterWWPlus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAOutdoorTemp(std::shared_ptr<const Telegram> telegram);
-    void process_UBASetPoints(std::shared_ptr<const Telegram> telegram);
-    void process_UBASetPoints2(std::shared_ptr<const Telegram> telegram);
-    void process_UBAFlags(std::shared_ptr<const Telegram> telegram);
-    void process_MC110Status(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMaintenanceStatus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMaintenanceData(std::shared_ptr<const Telegram> telegram);
-    void process_ErrorMessage(std::shared_ptr<const Telegram> telegram);
-    void process_UBAErrorMessage(std::shared_ptr<const Telegram> telegram);
-    void process_UBAErrorMessage2(std::shared_ptr<const Telegram> telegram);
-    void process_UBAErrorMessage3(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorWWPlus(std::shared_ptr<const Telegram> telegram);
-    void process_UBAInformation(std::shared_ptr<const Telegram> telegram);
-    void process_UBAEnergySupplied(std::shared_ptr<const Telegram> telegram);
-    void process_CascadeMessage(std::shared_ptr<const Telegram> telegram);
-    void process_UBASettingsWW(std::shared_ptr<const Telegram> telegram);
-    void process_HpPower(std::shared_ptr<const Telegram> telegram);
-    void process_HpTemperatures(std::shared_ptr<const Telegram> telegram);
-    void process_HpPool(std::shared_ptr<const Telegram> telegram);
-    void process_HpInput(std::shared_ptr<const Telegram> telegram);
-    void process_HpInConfig(std::shared_ptr<const Telegram> telegram);
-    void process_HpPressure(std::shared_ptr<const Telegram> telegram);
-    void process_HpCooling(std::shared_ptr<const Telegram> telegram);
-    void process_HpHeaterConfig(std::shared_ptr<const Telegram> telegram);
-    void process_HybridHp(std::shared_ptr<const Telegram> telegram);
-    void process_HpSilentMode(std::shared_ptr<const Telegram> telegram);
-    void process_HpAdditionalHeater(std::shared_ptr<const Telegram> telegram);
-    void process_HpValve(std::shared_ptr<const Telegram> telegram);
-    void process_HpPumps(std::shared_ptr<const Telegram> telegram);
-    void process_HpPump2(std::shared_ptr<const Telegram> telegram);
-    void process_HpDhwSettings(std::shared_ptr<const Telegram> telegram);
-    void process_HpSettings2(std::shared_ptr<const Telegram> telegram);
-    void process_HpSettings3(std::shared_ptr<const Telegram> telegram);
-    void process_HpEnergy(std::shared_ptr<const Telegram> telegram);
-    void process_HpMeters(std::shared_ptr<const Telegram> telegram);
-    void process_WeatherComp(std::shared_ptr<const Telegram> telegram);
-    void process_HpFan(std::shared_ptr<const Telegram> telegram);
-    void process_HpPower2(std::shared_ptr<const Telegram> telegram);
-    void process_HpPowerLimit(std::shared_ptr<const Telegram> telegram);
-
-    void process_Meters(std::shared_ptr<const Telegram> telegram);
-    void process_Energy(std::shared_ptr<const Telegram> telegram);
+    void process_UBAFactory(const Telegram & telegram);
+    void process_UBAParameterWW(const Telegram & telegram);
+    void process_UBAMonitorFast(const Telegram & telegram);
+    void process_UBATotalUptime(const Telegram & telegram);
+    void process_UBAParameters(const Telegram & telegram);
+    void process_UBAMonitorWW(const Telegram & telegram);
+    void process_UBAMonitorFastPlus(const Telegram & telegram);
+    void process_UBAMonitorSlow(const Telegram & telegram);
+    void process_UBAMonitorSlowPlus(const Telegram & telegram);
+    void process_UBAMonitorSlowPlus2(const Telegram & telegram);
+    void process_UBAParametersPlus(const Telegram & telegram);
+    void process_UBAParameterWWPlus(const Telegram & telegram);
+    void process_UBAOutdoorTemp(const Telegram & telegram);
+    void process_UBASetPoints(const Telegram & telegram);
+    void process_UBASetPoints2(const Telegram & telegram);
+    void process_UBAFlags(const Telegram & telegram);
+    void process_MC110Status(const Telegram & telegram);
+    void process_UBAMaintenanceStatus(const Telegram & telegram);
+    void process_UBAMaintenanceData(const Telegram & telegram);
+    void process_ErrorMessage(const Telegram & telegram);
+    void process_UBAErrorMessage(const Telegram & telegram);
+    void process_UBAErrorMessage2(const Telegram & telegram);
+    void process_UBAErrorMessage3(const Telegram & telegram);
+    void process_UBAMonitorWWPlus(const Telegram & telegram);
+    void process_UBAInformation(const Telegram & telegram);
+    void process_UBAEnergySupplied(const Telegram & telegram);
+    void process_CascadeMessage(const Telegram & telegram);
+    void process_UBASettingsWW(const Telegram & telegram);
+    void process_HpPower(const Telegram & telegram);
+    void process_HpTemperatures(const Telegram & telegram);
+    void process_HpPool(const Telegram & telegram);
+    void process_HpInput(const Telegram & telegram);
+    void process_HpInConfig(const Telegram & telegram);
+    void process_HpPressure(const Telegram & telegram);
+    void process_HpCooling(const Telegram & telegram);
+    void process_HpHeaterConfig(const Telegram & telegram);
+    void process_HybridHp(const Telegram & telegram);
+    void process_HpSilentMode(const Telegram & telegram);
+    void process_HpAdditionalHeater(const Telegram & telegram);
+    void process_HpValve(const Telegram & telegram);
+    void process_HpPumps(const Telegram & telegram);
+    void process_HpPump2(const Telegram & telegram);
+    void process_HpDhwSettings(const Telegram & telegram);
+    void process_HpSettings2(const Telegram & telegram);
+    void process_HpSettings3(const Telegram & telegram);
+    void process_HpEnergy(const Telegram & telegram);
+    void process_HpMeters(const Telegram & telegram);
+    void process_WeatherComp(const Telegram & telegram);
+    void process_HpFan(const Telegram & telegram);
+    void process_HpPower2(const Telegram & telegram);
+    void process_HpPowerLimit(const Telegram & telegram);
+
+    void process_Meters(const Telegram & telegram);
+    void process_Energy(const Telegram & telegram);
 
     // HIU
-    void process_HIUSettings(std::shared_ptr<const Telegram> telegram);
-    void process_HIUMonitor(std::shared_ptr<const Telegram> telegram);
+    void process_HIUSettings(const Telegram & telegram);
+    void process_HIUMonitor(const Telegram & telegram);
 
     bool set_keepWarmTemp(const char * value, const int8_t id);
     bool set_returnTemp(const char * value, const int8_t id);
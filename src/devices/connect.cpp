@@ -59,25 +59,25 @@ Connect::Connect(uint8_t device_type, uint8_t device_id, uint8_t product_id, con
 /*
  * OutdoorTemp - type 0xD1 - external temperature
  */
-void Connect::process_OutdoorTemp(std::shared_ptr<const Telegram> telegram) {
+void Connect::process_OutdoorTemp(const Telegram & telegram) {
     has_update(telegram, outdoorTemp_, 0);
 }
 
 // sent if thermostat is connected
 // https://github.com/emsesp/EMS-ESP32/issues/2277
-void Connect::process_RCTime(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset || telegram->message_length < 10) {
+void Connect::process_RCTime(const Telegram & telegram) {
+    if (telegram.offset || telegram.message_length < 10) {
         return;
     }
     char time[sizeof(dateTime_)];
     snprintf(time,
              sizeof(time),
              "%02d.%02d.%04d %02d:%02d",
-             telegram->message_data[3],
-             telegram->message_data[1],
-             telegram->message_data[0] + 2000,
-             telegram->message_data[2],
-             telegram->message_data[4]);
+             telegram.message_data[3],
+             telegram.message_data[1],
+             telegram.message_data[0] + 2000,
+             telegram.message_data[2],
+             telegram.message_data[4]);
     has_update(dateTime_, time, sizeof(dateTime_));
 }
 
@@ -121,9 +121,9 @@ std::shared_ptr<Connect::RoomCircuit> Connect::room_circuit(const uint8_t num, c
 }
 
 // gateway(0x50) B all(0x00), ?(0x0BDD), data: 00 E6 36 2A
-void Connect::process_roomThermostat(std::shared_ptr<const Telegram> telegram) {
-    bool create = telegram->offset == 0 && telegram->message_data[0] < 0x80;
-    auto rc     = room_circuit(telegram->type_id - 0xBDD, create);
+void Connect::process_roomThermostat(const Telegram & telegram) {
+    bool create = telegram.offset == 0 && telegram.message_data[0] < 0x80;
+    auto rc     = room_circuit(telegram.type_id - 0xBDD, create);
     if (rc == nullptr) {
         return;
     }
@@ -142,15 +142,15 @@ void Connect::process_roomThermostat(std::shared_ptr<const Telegram> telegram) {
 
 // gateway(0x48) W gateway(0x50), ?(0x0B42), data: 01 // icon in offset 0
 // gateway(0x48) W gateway(0x50), ?(0x0B42), data: 00 4B 00 FC 00 63 00 68 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 (offset 1)
-void Connect::process_roomThermostatName(std::shared_ptr<const Telegram> telegram) {
-    auto rc = room_circuit(telegram->type_id - 0xB3D);
+void Connect::process_roomThermostatName(const Telegram & telegram) {
+    auto rc = room_circuit(telegram.type_id - 0xB3D);
     if (rc == nullptr) {
         return;
     }
     has_update(telegram, rc->icon_, 0);
-    for (uint8_t i = telegram->offset; i < telegram->message_length + telegram->offset && i < 100; i++) {
+    for (uint8_t i = telegram.offset; i < telegram.message_length + telegram.offset && i < 100; i++) {
         if ((i > 1) && (i % 2) == 0) {
-            rc->name_[(i - 2) / 2] = telegram->message_data[i - telegram->offset];
+            rc->name_[(i - 2) / 2] = telegram.message_data[i - telegram.offset];
         }
     }
     rc->name_[50] = '\0'; // make sure name is terminated
@@ -158,8 +158,8 @@ void Connect::process_roomThermostatName(std::shared_ptr<const Telegram> telegra
 
 // settings 0-mode, 1-tempautotemp, 3 - manualtemp, 6 - ?, 7 - childlock
 // 0x0BB5, ff: data: 00 FF 00 24 01 FF 24 00
-void Connect::process_roomThermostatSettings(std::shared_ptr<const Telegram> telegram) {
-    auto rc = room_circuit(telegram->type_id - 0xBB5);
+void Connect::process_roomThermostatSettings(const Telegram & telegram) {
+    auto rc = room_circuit(telegram.type_id - 0xBB5);
     if (rc == nullptr) {
         return;
     }
@@ -171,31 +171,31 @@ void Connect::process_roomThermostatSettings(std::shared_ptr<const Telegram> tel
 }
 
 // unknown telegrams, needs fetch
-void Connect::process_roomThermostatParam(std::shared_ptr<const Telegram> telegram) {
-    auto rc = room_circuit(telegram->type_id - 0x1230);
+void Connect::process_roomThermostatParam(const Telegram & telegram) {
+    auto rc = room_circuit(telegram.type_id - 0x1230);
     if (rc == nullptr) {
         return;
     }
 }
 
 // unknown broadcasted telegrams
-void Connect::process_roomThermostatData(std::shared_ptr<const Telegram> telegram) {
-    auto rc = room_circuit(telegram->type_id - 0x1244);
+void Connect::process_roomThermostatData(const Telegram & telegram) {
+    auto rc = room_circuit(telegram.type_id - 0x1244);
     if (rc == nullptr) {
         return;
     }
 }
 
 // schedule for all thermostats
-void Connect::process_roomSchedule(std::shared_ptr<const Telegram> telegram) {
-    uint8_t length = ((telegram->offset + telegram->message_length) > 126) ? 126 - telegram->offset : telegram->message_length;
-    memcpy(&schedule_[telegram->offset], telegram->message_data, length);
+void Connect::process_roomSchedule(const Telegram & telegram) {
+    uint8_t length = ((telegram.offset + telegram.message_length) > 126) ? 126 - telegram.offset : telegram.message_length;
+    memcpy(&schedule_[telegram.offset], telegram.message_data, length);
     for (uint8_t c : schedule_) {
         if (c == 0xFE) {
             return;
         }
     }
-    toggle_fetch(telegram->type_id, false); // fetch only once if all is initialized
+    toggle_fetch(telegram.type_id, false); // fetch only once if all is initialized
 }
 
 // Settings:
@@ -32,8 +32,8 @@ Controller::Controller(uint8_t device_type, uint8_t device_id, uint8_t product_i
 }
 
 // process_dateTime - type 0x06 - date and time from a thermostat - 14 bytes long, IVT only
-void Controller::process_dateTime(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 5) {
+void Controller::process_dateTime(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 5) {
         return;
     }
     char newdatetime[sizeof(dateTime_)];
@@ -41,11 +41,11 @@ void Controller::process_dateTime(std::shared_ptr<const Telegram> telegram) {
     snprintf(newdatetime,
              sizeof(dateTime_),
              "%02d.%02d.%04d %02d:%02d",
-             telegram->message_data[3],
-             telegram->message_data[1] - 1,
-             (telegram->message_data[0] & 0x7F) + 2000,
-             telegram->message_data[2],
-             telegram->message_data[4]);
+             telegram.message_data[3],
+             telegram.message_data[1] - 1,
+             (telegram.message_data[0] & 0x7F) + 2000,
+             telegram.message_data[2],
+             telegram.message_data[4]);
     has_update(dateTime_, newdatetime, sizeof(dateTime_));
 }
 
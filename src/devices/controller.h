@@ -27,7 +27,7 @@ class Controller : public EMSdevice {
   public:
     Controller(uint8_t device_type, uint8_t device_id, uint8_t product_id, const char * version, const char * name, uint8_t flags, uint8_t brand);
 
-    void process_dateTime(std::shared_ptr<const Telegram> telegram);
+    void process_dateTime(const Telegram & telegram);
 
     char dateTime_[25];
 };
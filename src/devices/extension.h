@@ -28,12 +28,12 @@ class Extension : public EMSdevice {
     Extension(uint8_t device_type, uint8_t device_id, uint8_t product_id, const char * version, const char * name, uint8_t flags, uint8_t brand);
 
   private:
-    void process_EM100SetMessage(std::shared_ptr<const Telegram> telegram);
-    void process_EM100OutMessage(std::shared_ptr<const Telegram> telegram);
-    void process_EM100MonitorMessage(std::shared_ptr<const Telegram> telegram);
-    void process_EM100TempMessage(std::shared_ptr<const Telegram> telegram);
-    void process_EM100InputMessage(std::shared_ptr<const Telegram> telegram);
-    void process_EM100ConfigMessage(std::shared_ptr<const Telegram> telegram);
+    void process_EM100SetMessage(const Telegram & telegram);
+    void process_EM100OutMessage(const Telegram & telegram);
+    void process_EM100MonitorMessage(const Telegram & telegram);
+    void process_EM100TempMessage(const Telegram & telegram);
+    void process_EM100InputMessage(const Telegram & telegram);
+    void process_EM100ConfigMessage(const Telegram & telegram);
 
     bool set_minV(const char * value, const int8_t id);
     bool set_maxV(const char * value, const int8_t id);
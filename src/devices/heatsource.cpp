@@ -96,14 +96,14 @@ Heatsource::Heatsource(uint8_t device_type, uint8_t device_id, uint8_t product_i
  */
 
 // 0x6DC, ff for cascaded heatsources (hs)
-void Heatsource::process_CascadeMessage(std::shared_ptr<const Telegram> telegram) {
-    telegram->read_value(burnWorkMin_, 3); // this is in seconds
+void Heatsource::process_CascadeMessage(const Telegram & telegram) {
+    telegram.read_value(burnWorkMin_, 3); // this is in seconds
     burnWorkMin_ /= 60;
     has_update(burnWorkMin_);
 }
 
 // UBAMonitorFastPlus - type 0xE4 - central heating monitor EMS+
-void Heatsource::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_UBAMonitorFastPlus(const Telegram & telegram) {
     has_update(telegram, setFlowTemp_, 6);
     has_update(telegram, curBurnPow_, 10);
     has_update(telegram, selBurnPow_, 9);
@@ -116,7 +116,7 @@ void Heatsource::process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> tele
 // 0x054D AM200 temperatures
 // Rx: 60 00 FF 00 04 4D 0103 0108 8000 00C6 0127 0205 8000 0200 0000 8000 6C
 //                        TB4  TR2       TA1  TR1  TB1  TB2* TB3
-void Heatsource::process_amTempMessage(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_amTempMessage(const Telegram & telegram) {
     has_update(telegram, curFlowTemp_, 0); // TB4
     has_update(telegram, retTemp_, 2);     // TR2
     has_update(telegram, flueGasTemp_, 4);
@@ -129,7 +129,7 @@ void Heatsource::process_amTempMessage(std::shared_ptr<const Telegram> telegram)
 
 // 0x054E AM200 status (6 bytes long)
 // Rx: 60 00 FF 00 04 4E 00 00 00 00 00 00 86
-void Heatsource::process_amStatusMessage(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_amStatusMessage(const Telegram & telegram) {
     has_update(telegram, aPumpMod_, 0); // PR1
     // offset 1: bitfield 01-pump on, 02-VR1 opening, 04-VR1 closing, 08-VB1 opening, 10-VB1 closing
     // actually we dont know the offset of VR2
@@ -143,7 +143,7 @@ void Heatsource::process_amStatusMessage(std::shared_ptr<const Telegram> telegra
 
 // 0x054C AM200 not broadcasted message, 23 bytes long
 // data: 00 01 01 00 01 00 41 4B 00 5A 00 5A 00 01 05 3C 00 00 5A 00 01 23 00
-void Heatsource::process_amSettingMessage(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_amSettingMessage(const Telegram & telegram) {
     has_update(telegram, vr2Config_, 12);     // pos 12: off(00)/bypass(01)
     has_update(telegram, ahsActivated_, 0);   // pos 00: Alternate heat source activation: No(00),Yes(01)
     has_update(telegram, aPumpConfig_, 4);    // pos 04: Buffer primary pump->Config pump: No(00),Yes(01)
@@ -164,7 +164,7 @@ void Heatsource::process_amSettingMessage(std::shared_ptr<const Telegram> telegr
 
 // 0x054F AM200 not broadcasted message, 7 bytes long
 // Boiler(0x60) -> Me(0x0B), amCommand(0x054F), data: 00 00 00 00 00 00 00
-void Heatsource::process_amCommandMessage(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_amCommandMessage(const Telegram & telegram) {
     // pos 0: return pump in percent
     // pos 3: setValveBuffer VB1 0-off, 1-open, 2-close
     // pos 2: setValveReturn VR1 0-off, 1-open, 2-close
@@ -174,7 +174,7 @@ void Heatsource::process_amCommandMessage(std::shared_ptr<const Telegram> telegr
 // 0x0550 AM200 broadcasted message, all 27 bytes unkown
 // Rx: 60 00 FF 00 04 50 00 FF 00 FF FF 00 0D 00 01 00 00 00 00 01 03 01 00 03 00 2D 19 C8 02 94 00 4A
 // Rx: 60 00 FF 19 04 50 00 FF FF 39
-void Heatsource::process_amExtraMessage(std::shared_ptr<const Telegram> telegram) {
+void Heatsource::process_amExtraMessage(const Telegram & telegram) {
     has_update(telegram, blockRemain_, 24);   // minutes
     has_update(telegram, blockRemainWw_, 25); // minutes
 }
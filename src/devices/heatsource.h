@@ -72,14 +72,14 @@ class Heatsource : public EMSdevice {
     int8_t   blockHyst_;     // pos 14?: Hyst. for bolier block (K)
     uint8_t  releaseWait_;   // pos 15: Boiler release wait time (min)
 
-    void process_CascadeMessage(std::shared_ptr<const Telegram> telegram);
-    void process_UBAMonitorFastPlus(std::shared_ptr<const Telegram> telegram);
+    void process_CascadeMessage(const Telegram & telegram);
+    void process_UBAMonitorFastPlus(const Telegram & telegram);
 
-    void process_amTempMessage(std::shared_ptr<const Telegram> telegram);
-    void process_amStatusMessage(std::shared_ptr<const Telegram> telegram);
-    void process_amSettingMessage(std::shared_ptr<const Telegram> telegram);
-    void process_amCommandMessage(std::shared_ptr<const Telegram> telegram);
-    void process_amExtraMessage(std::shared_ptr<const Telegram> telegram);
+    void process_amTempMessage(const Telegram & telegram);
+    void process_amStatusMessage(const Telegram & telegram);
+    void process_amSettingMessage(const Telegram & telegram);
+    void process_amCommandMessage(const Telegram & telegram);
+    void process_amExtraMessage(const Telegram & telegram);
 
 
     bool set_vr2Config(const char * value, const int8_t id);     // pos 12: off(00)/Keelbypass(01)/(hc1pump(02) only standalone)
@@ -91,7 +91,7 @@ Mixer::Mixer(uint8_t device_type, uint8_t device_id, uint8_t product_id, const c
 // heating circuits 0x02D7, 0x02D8 etc...
 // e.g.  A0 00 FF 00 01 D7 00 00 00 80 00 00 00 00 03 C5
 //       A0 0B FF 00 01 D7 00 00 00 80 00 00 00 00 03 80
-void Mixer::process_MMPLUSStatusMessage_HC(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_MMPLUSStatusMessage_HC(const Telegram & telegram) {
     has_update(telegram, flowTempHc_, 3); // is * 10
     has_update(telegram, flowSetTemp_, 5);
     has_bitupdate(telegram, pumpStatus_, 0, 0);
@@ -102,10 +102,10 @@ void Mixer::process_MMPLUSStatusMessage_HC(std::shared_ptr<const Telegram> teleg
 // Mixer IPM - 0x010C
 // e.g.  A0 00 FF 00 00 0C 01 00 00 00 00 00 54
 //       A1 00 FF 00 00 0C 02 04 00 01 1D 00 82
-void Mixer::process_IPMStatusMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_IPMStatusMessage(const Telegram & telegram) {
     // check if circuit is active, 0-off, 1-unmixed, 2-mixed
     uint8_t ismixed = 0;
-    telegram->read_value(ismixed, 0);
+    telegram.read_value(ismixed, 0);
     if (ismixed == 0) {
         return;
     }
@@ -122,14 +122,14 @@ void Mixer::process_IPMStatusMessage(std::shared_ptr<const Telegram> telegram) {
 
 // Mixer IPM - 0x001E Temperature Message in unmixed circuits
 // in unmixed circuits FlowTemp in 10C is zero, this is the measured flowtemp in header
-void Mixer::process_IPMTempMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_IPMTempMessage(const Telegram & telegram) {
     has_update(telegram, flowTempVf_, 0); // TC1, is * 10
 }
 
 // Mixer on a MM10 - 0xAB
 // e.g. Mixer Module -> All, type 0xAB, telegram: 21 00 AB 00 2D 01 BE 64 04 01 00 (CRC=15) #data=7
 // see also https://github.com/emsesp/EMS-ESP/issues/386
-void Mixer::process_MMStatusMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_MMStatusMessage(const Telegram & telegram) {
     // the heating circuit is determine by which device_id it is, 0x20 - 0x23
     // 0x21 is position 2. 0x20 is typically reserved for the WM10 switch module
     // see https://github.com/emsesp/EMS-ESP/issues/270 and https://github.com/emsesp/EMS-ESP/issues/386#issuecomment-629610918
@@ -147,14 +147,14 @@ void Mixer::process_MMStatusMessage(std::shared_ptr<const Telegram> telegram) {
 
 // Mixer on a MM10 - 0xAA
 // e.g. Thermostat -> Mixer Module, type 0xAA, telegram: 10 21 AA 00 FF 0C 0A 11 0A 32 xx
-void Mixer::process_MMConfigMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_MMConfigMessage(const Telegram & telegram) {
     has_update(telegram, activated_, 0);    // on = 0xFF
     has_update(telegram, setValveTime_, 1); // valve runtime in 10 sec, max 120 s
 }
 
 // Mixer Config 0x2CD, ..
 // mixer(0x20) -W-> Me(0x0B), ?(0x02CD), data: FF 0E 05 FF 1E 00
-void Mixer::process_MMPLUSConfigMessage_HC(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_MMPLUSConfigMessage_HC(const Telegram & telegram) {
     has_update(telegram, activated_, 0);      // on = 0xFF
     has_update(telegram, setValveTime_, 1);   // valve runtime in 10 sec, default 120 s, max 600 s
     has_update(telegram, flowTempOffset_, 2); // Mixer increase [0-20 K]
@@ -165,14 +165,14 @@ void Mixer::process_MMPLUSConfigMessage_HC(std::shared_ptr<const Telegram> teleg
 // Thermostat(0x10) -> Mixer(0x20), ?(0x2E1), data: 01 1C 64 00 01
 // Thermostat(0x10) -> Mixing Module(0x20), (0x2E1), data: 01 00 00 00 01
 // Thermostat(0x10) -> Mixing Module(0x20), (0x2EB), data: 00
-// void Mixer::process_MMPLUSSetMessage_HC(std::shared_ptr<const Telegram> telegram) {
+// void Mixer::process_MMPLUSSetMessage_HC(const Telegram & telegram) {
 // pos 1: setpoint
 // pos2: pump
 // }
 
 // Mixer on a MM10 - 0xAC
 // e.g. Thermostat -> Mixer Module, type 0xAC, telegram: 10 21 AC 00 1E 64 01 AB
-void Mixer::process_MMSetMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_MMSetMessage(const Telegram & telegram) {
     // pos 0: flowtemp setpoint 1E = 30°C
     // pos 1: pump in %
     // pos 2 flags (mostly 01)
@@ -180,7 +180,7 @@ void Mixer::process_MMSetMessage(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Thermostat(0x10) -> Mixer(0x21), ?(0x23), data: 1A 64 00 90 21 23 00 1A 64 00 89
-void Mixer::process_IPMSetMessage(std::shared_ptr<const Telegram> telegram) {
+void Mixer::process_IPMSetMessage(const Telegram & telegram) {
     // pos 0: flowtemp setpoint 1A = 26°C
     // pos 1: pump in %?
 }
@@ -436,16 +436,16 @@ Solar::Solar(uint8_t device_type, uint8_t device_id, uint8_t product_id, const c
 
 // SM10Monitor - type 0x96
 // Solar(0x30) -> All(0x00), (0x96), data: FF 18 19 0A 02 5A 27 0A 05 2D 1E 0F 64 28 0A
-void Solar::process_SM10Config(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM10Config(const Telegram & telegram) {
     has_update(telegram, solarIsEnabled_, 0); // FF on
     has_update(telegram, setting3_, 3);
     has_update(telegram, setting4_, 4);
     /*
     uint8_t colmax = collectorMaxTemp_ / 10;
-    telegram->read_value(colmax, 3);
+    telegram.read_value(colmax, 3);
     has_update(collectorMaxTemp_, colmax * 10);
     uint8_t colmin = collectorMinTemp_ / 10;
-    telegram->read_value(colmin, 4);
+    telegram.read_value(colmin, 4);
     has_update(collectorMinTemp_, colmin * 10);
     */
     has_update(telegram, solarPumpMinMod_, 2);
@@ -457,7 +457,7 @@ void Solar::process_SM10Config(std::shared_ptr<const Telegram> telegram) {
 
 // SM10Monitor - type 0x97
 //  Solar(0x30) -> All(0x00), SM10Monitor(0x97), data: 00 00 00 22 00 00 D2 01 00 F6 2A 00 00
-void Solar::process_SM10Monitor(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM10Monitor(const Telegram & telegram) {
     uint8_t solarpumpmod = solarPumpMod_;
 
     has_update(telegram, data0_, 0);
@@ -468,7 +468,7 @@ void Solar::process_SM10Monitor(std::shared_ptr<const Telegram> telegram) {
     has_bitupdate(telegram, collectorShutdown_, 0, 3); // collectorMaxTemp reached
     has_bitupdate(telegram, cylHeated_, 0, 2);         // cylMaxTemp reached
     has_update(telegram, collectorTemp_, 2);           // collector temp from SM10, is *10
-    telegram->read_value(solarpumpmod, 4);             // modulation solar pump
+    telegram.read_value(solarpumpmod, 4);             // modulation solar pump
     has_update(telegram, cylBottomTemp_, 5);           // cyl bottom temp from SM10, is *10
     has_bitupdate(telegram, solarPump_, 7, 1);         // pump onoff
     has_update(telegram, pumpWorkTime_, 8, 3);
@@ -485,7 +485,7 @@ void Solar::process_SM10Monitor(std::shared_ptr<const Telegram> telegram) {
     }
 
     // solar publishes every minute, do not count reads by other devices
-    if (telegram->dest == 0) {
+    if (telegram.dest == 0) {
         // water 4.184 J/gK, glycol ~2.6-2.8 J/gK, no aceotrope
         // solarPower_ = (collectorTemp_ - cylBottomTemp_) * solarPumpModulation_ * maxFlow_ * 10 / 1434; // water
         solarPower_ = (collectorTemp_ - cylBottomTemp_) * solarpumpmod * maxFlow_ * 10 / 1665; //40% glycol@40°C
@@ -509,7 +509,7 @@ void Solar::process_SM10Monitor(std::shared_ptr<const Telegram> telegram) {
  * SM100SystemConfig(0x358), data: FF 00 FF 00 FF 00 00 00 00 00 00 FF 00 00 FF 00 00 00 00 FF 00 FF 01 01 00
  * SM100SystemConfig(0x358), data: 00 00 00 00 00 00 00 (offset 25)
  */
-void Solar::process_SM100SystemConfig(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100SystemConfig(const Telegram & telegram) {
     has_update(telegram, heatTransferSystem_, 5, 1);
     has_update(telegram, externalCyl_, 9, 1);
     has_update(telegram, thermalDisinfect_, 10, 1);
@@ -521,7 +521,7 @@ void Solar::process_SM100SystemConfig(std::shared_ptr<const Telegram> telegram)
  * process_SM100SolarCircuitConfig - type 0x035A EMS+ - for MS/SM100 and MS/SM200
  * e.g. B0 0B FF 00 02 5A 64 05 00 58 14 01 01 32 64 00 00 00 5A 0C
  */
-void Solar::process_SM100CircuitConfig(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100CircuitConfig(const Telegram & telegram) {
     has_update(telegram, collectorMaxTemp_, 0);
     has_update(telegram, cylMaxTemp_, 3);
     has_update(telegram, collectorMinTemp_, 4);
@@ -537,7 +537,7 @@ void Solar::process_SM100CircuitConfig(std::shared_ptr<const Telegram> telegram)
 /*
  * process_SM100Solar2CircuitConfig - type 0x035D EMS+ - for MS/SM100 and MS/SM200
  */
-void Solar::process_SM100Circuit2Config(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Circuit2Config(const Telegram & telegram) {
     has_update(telegram, solarPump2Kick_, 0);
     //has_update(telegram, solar2PumpTurnoffDiff_, 3); // is * 10
     has_update(telegram, solarPump2TurnonDiff_, 4); // is * 10
@@ -553,13 +553,13 @@ void Solar::process_SM100Circuit2Config(std::shared_ptr<const Telegram> telegram
 }
 
 // type 0x35C Heat assistance
-void Solar::process_SM100HeatAssist(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100HeatAssist(const Telegram & telegram) {
     has_update(telegram, heatAssistOn_, 0);  // is *10
     has_update(telegram, heatAssistOff_, 1); // is *10
 }
 
 // type 0x361 differential control
-void Solar::process_SM100Differential(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Differential(const Telegram & telegram) {
     has_update(telegram, diffControl_, 0); // is *10
 }
 
@@ -576,19 +576,19 @@ void Solar::process_SM100Differential(std::shared_ptr<const Telegram> telegram)
 // bytes 13..16 = maximum value
 // bytes 17..20 = current value
 // e.g. B0 0B F9 00 00 02 5A 00 00 6E
-void Solar::process_SM100ParamCfg(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100ParamCfg(const Telegram & telegram) {
     uint16_t t_id = EMS_VALUE_UINT16_NOTSET;
     uint8_t  of   = EMS_VALUE_UINT8_NOTSET;
     int32_t  min  = EMS_VALUE_UINT16_NOTSET;
     int32_t  def  = EMS_VALUE_UINT16_NOTSET;
     int32_t  max  = EMS_VALUE_UINT16_NOTSET;
     int32_t  cur  = EMS_VALUE_UINT16_NOTSET;
-    telegram->read_value(t_id, 1);
-    telegram->read_value(of, 3);
-    telegram->read_value(min, 5);
-    telegram->read_value(def, 9);
-    telegram->read_value(max, 13);
-    telegram->read_value(cur, 17);
+    telegram.read_value(t_id, 1);
+    telegram.read_value(of, 3);
+    telegram.read_value(min, 5);
+    telegram.read_value(def, 9);
+    telegram.read_value(max, 13);
+    telegram.read_value(cur, 17);
 
     // LOG_DEBUG("SM100ParamCfg param=0x%04X, offset=%d, min=%d, default=%d, max=%d, current=%d", t_id, of, min, def, max, cur));
 }
@@ -604,7 +604,7 @@ void Solar::process_SM100ParamCfg(std::shared_ptr<const Telegram> telegram) {
  * bytes 16+17 = TS5 Temperature sensor 2 cylinder, bottom, or swimming pool
  * bytes 20+21 = TS6 Temperature sensor external heat exchanger
  */
-void Solar::process_SM100Monitor(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Monitor(const Telegram & telegram) {
     has_update(telegram, collectorTemp_, 0);      // is *10 - TS1: Temperature sensor for collector array 1
     has_update(telegram, cylBottomTemp_, 2);      // is *10 - TS2: Temperature sensor 1 cylinder, bottom
     has_update(telegram, cylBottomTemp2_, 16);    // is *10 - TS5: Temperature sensor 2 cylinder, bottom, or swimming pool
@@ -620,7 +620,7 @@ void Solar::process_SM100Monitor(std::shared_ptr<const Telegram> telegram) {
 // SM100Monitor2 - 0x0363 Heatcounter
 // e.g. B0 00 FF 00 02 63 80 00 80 00 00 00 80 00 80 00 80 00 00 80 00 5A
 // Solar(0x30) -> All(0x00), SM100Monitor2(0x363), data: 01 E1 01 6B 00 00 01 5D 02 8E 80 00 0F 80 00
-void Solar::process_SM100Monitor2(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Monitor2(const Telegram & telegram) {
     has_update(telegram, heatCntFlowTemp_, 0); // is *10
     has_update(telegram, heatCntRetTemp_, 2);  // is *10
     has_update(telegram, heatCnt_, 12);
@@ -632,7 +632,7 @@ void Solar::process_SM100Monitor2(std::shared_ptr<const Telegram> telegram) {
 
 // SM100Config - 0x0366
 // e.g. B0 00 FF 00 02 66     01 62 00 13 40 14
-void Solar::process_SM100Config(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Config(const Telegram & telegram) {
     has_update(telegram, availabilityFlag_, 0);
     has_update(telegram, configFlag_, 1);
     has_update(telegram, userFlag_, 2);
@@ -640,7 +640,7 @@ void Solar::process_SM100Config(std::shared_ptr<const Telegram> telegram) {
 
 // SM100Config1 - 0x035F
 // e.g. Solar(0x30) -> Me(0x0B), ?(0x35F), data: 00 00 41 01 1E 0A 0C 19 00 3C 19
-void Solar::process_SM100Config1(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Config1(const Telegram & telegram) {
     has_update(telegram, cylPriority_, 3);
 }
 
@@ -651,11 +651,11 @@ void Solar::process_SM100Config1(std::shared_ptr<const Telegram> telegram) {
  * e.g. 30 00 FF 09 02 64 64 = 100%
  * Solar(0x30) -> All(0x00), (0x364), data: 00 64 05 24 00 00 FF 00 00 05 00 14 3C 64 00 00 00 00
  */
-void Solar::process_SM100Status(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Status(const Telegram & telegram) {
     uint8_t solarpumpmod    = solarPumpMod_;
     uint8_t cylinderpumpmod = cylPumpMod_;
-    telegram->read_value(cylinderpumpmod, 8);
-    telegram->read_value(solarpumpmod, 9);
+    telegram.read_value(cylinderpumpmod, 8);
+    telegram.read_value(solarpumpmod, 9);
 
     // mask out boosts
     if (solarpumpmod == 100 && solarPumpMod_ == 0 && solarPumpMinMod_ > 0) {
@@ -672,7 +672,7 @@ void Solar::process_SM100Status(std::shared_ptr<const Telegram> telegram) {
     has_update(telegram, m1Power_, 13);
 
     solarpumpmod = solarPump2Mod_;
-    telegram->read_value(solarpumpmod, 4);
+    telegram.read_value(solarpumpmod, 4);
     // mask out boost
     if (solarpumpmod == 100 && solarPump2Mod_ == 0 && solarPumpMinMod_ > 0) {
         solarpumpmod = solarPumpMinMod_ * 5; // set to minimum
@@ -688,7 +688,7 @@ void Solar::process_SM100Status(std::shared_ptr<const Telegram> telegram) {
  * byte 4 = VS2 3-way valve for cylinder 2 : test=01, on=04 and off=03
  * byte 10 = PS1 Solar circuit pump for collector array 1: test=b0001(1), on=b0100(4) and off=b0011(3)
  */
-void Solar::process_SM100Status2(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Status2(const Telegram & telegram) {
     has_bitupdate(telegram, vs1Status_, 0, 2);     // on if bit 2 set
     has_bitupdate(telegram, valveStatus_, 4, 2);   // on if bit 2 set
     has_bitupdate(telegram, solarPump_, 10, 2);    // on if bit 2 set
@@ -702,14 +702,14 @@ void Solar::process_SM100Status2(std::shared_ptr<const Telegram> telegram) {
  * e.g. B0 0B FF 00 02 80 50 64 00 00 29 01 00 00 01
  * SM100CollectorConfig(0x380), data: 5A 3B 00 00 41 02 00 2D 02 (with 2 collectors)
  */
-void Solar::process_SM100CollectorConfig(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100CollectorConfig(const Telegram & telegram) {
     has_update(telegram, climateZone_, 0);
     has_update(telegram, collector1Area_, 3);
     // has_enumupdate(telegram, collector1Type_, 5, 1);
     // has_update(telegram, collector2Area_, 6);
     // do not show collector 2 if area is zero
-    telegram->read_value(collector2Area_, 6);
-    telegram->read_enumvalue(collector2Type_, 8, 1);
+    telegram.read_value(collector2Area_, 6);
+    telegram.read_enumvalue(collector2Type_, 8, 1);
     if (collector2Area_ == 0) {
         collector2Area_ = EMS_VALUE_UINT16_NOTSET;
         collector2Type_ = EMS_VALUE_UINT8_NOTSET;
@@ -722,7 +722,7 @@ void Solar::process_SM100CollectorConfig(std::shared_ptr<const Telegram> telegra
  * e.g. 30 00 FF 00 02 8E 00 00 00 00 00 00 06 C5 00 00 76 35
  * SM100Energy(0x38E), data: 00 00 01 79 00 00 22 3D 00 00 09 31 (with 2 collectors)
  */
-void Solar::process_SM100Energy(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Energy(const Telegram & telegram) {
     has_update(telegram, energyLastHour_, 0); // last hour / 10 in Wh
     has_update(telegram, energyToday_, 4);    // todays in Wh
     has_update(telegram, energyTotal_, 8);    // total / 10 in kWh
@@ -733,7 +733,7 @@ void Solar::process_SM100Energy(std::shared_ptr<const Telegram> telegram) {
  * SM100Time(0x391), data: 00 00 2A 13 00 00 00 00 00 00 70 13 00 00 00 00 00 00 24 7E 00 00 00 00 00
  * SM100Time(0x391), data: 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 12 4A 00 (offset 24)
  */
-void Solar::process_SM100Time(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_SM100Time(const Telegram & telegram) {
     has_update(telegram, pumpWorkTime_, 1, 3);
     // has_update(telegram, pumpXWorkTime_, 9, 3);
     has_update(telegram, pump2WorkTime_, 17, 3);
@@ -744,11 +744,11 @@ void Solar::process_SM100Time(std::shared_ptr<const Telegram> telegram) {
  * Junkers ISM1 Solar Module - type 0x0103 EMS+ for energy readings
  *  e.g. B0 00 FF 00 00 03 32 00 00 00 00 13 00 D6 00 00 00 FB D0 F0
  */
-void Solar::process_ISM1StatusMessage(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_ISM1StatusMessage(const Telegram & telegram) {
     has_update(telegram, collectorTemp_, 4); // Collector Temperature
     has_update(telegram, cylBottomTemp_, 6); // Temperature Bottom of Solar Boiler cyl
     uint16_t Wh = energyLastHour_ / 10;
-    telegram->read_value(Wh, 2); // Solar Energy produced in last hour only ushort, is not * 10
+    telegram.read_value(Wh, 2); // Solar Energy produced in last hour only ushort, is not * 10
     if (energyLastHour_ != Wh * 10) {
         energyLastHour_ = Wh * 10;
         has_update(&energyLastHour_);
@@ -766,7 +766,7 @@ void Solar::process_ISM1StatusMessage(std::shared_ptr<const Telegram> telegram)
  * ?(0x104), data: 01 A9 01 22 27 0F 27 0F 27 0F 27 0F 27 0F 27 0F
  * ?(0x104), data: 01 01 00 00 00 00 00 27 0F 27 0F (offset 16)
  */
-void Solar::process_ISM2StatusMessage(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_ISM2StatusMessage(const Telegram & telegram) {
     has_update(telegram, cylMiddleTemp_, 0);  // Temperature Middle of Solar Boiler cyl
     has_update(telegram, retHeatAssist_, 2);  // return temperature from heating T4
     has_bitupdate(telegram, m1Valve_, 17, 0); // return valve DUW1 (also 16,0)
@@ -775,7 +775,7 @@ void Solar::process_ISM2StatusMessage(std::shared_ptr<const Telegram> telegram)
 /*
  * Junkers ISM1 Solar Module - type 0x0101 EMS+ for setting values
  */
-void Solar::process_ISM1Set(std::shared_ptr<const Telegram> telegram) {
+void Solar::process_ISM1Set(const Telegram & telegram) {
     has_update(telegram, cylMaxTemp_, 6);
 }
 
@@ -136,30 +136,30 @@ class Solar : public EMSdevice {
 
     std::deque<int16_t> energy;
 
-    void process_SM10Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_SM10Config(std::shared_ptr<const Telegram> telegram);
-    void process_SM100SystemConfig(std::shared_ptr<const Telegram> telegram);
-    void process_SM100CircuitConfig(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Circuit2Config(std::shared_ptr<const Telegram> telegram);
-    void process_SM100ParamCfg(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Monitor2(std::shared_ptr<const Telegram> telegram);
-
-    void process_SM100Config(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Config1(std::shared_ptr<const Telegram> telegram);
-
-    void process_SM100Status(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Status2(std::shared_ptr<const Telegram> telegram);
-    void process_SM100CollectorConfig(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Energy(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Time(std::shared_ptr<const Telegram> telegram);
-
-    void process_SM100HeatAssist(std::shared_ptr<const Telegram> telegram);
-    void process_SM100Differential(std::shared_ptr<const Telegram> telegram);
-
-    void process_ISM1StatusMessage(std::shared_ptr<const Telegram> telegram);
-    void process_ISM1Set(std::shared_ptr<const Telegram> telegram);
-    void process_ISM2StatusMessage(std::shared_ptr<const Telegram> telegram);
+    void process_SM10Monitor(const Telegram & telegram);
+    void process_SM10Config(const Telegram & telegram);
+    void process_SM100SystemConfig(const Telegram & telegram);
+    void process_SM100CircuitConfig(const Telegram & telegram);
+    void process_SM100Circuit2Config(const Telegram & telegram);
+    void process_SM100ParamCfg(const Telegram & telegram);
+    void process_SM100Monitor(const Telegram & telegram);
+    void process_SM100Monitor2(const Telegram & telegram);
+
+    void process_SM100Config(const Telegram & telegram);
+    void process_SM100Config1(const Telegram & telegram);
+
+    void process_SM100Status(const Telegram & telegram);
+    void process_SM100Status2(const Telegram & telegram);
+    void process_SM100CollectorConfig(const Telegram & telegram);
+    void process_SM100Energy(const Telegram & telegram);
+    void process_SM100Time(const Telegram & telegram);
+
+    void process_SM100HeatAssist(const Telegram & telegram);
+    void process_SM100Differential(const Telegram & telegram);
+
+    void process_ISM1StatusMessage(const Telegram & telegram);
+    void process_ISM1Set(const Telegram & telegram);
+    void process_ISM2StatusMessage(const Telegram & telegram);
 
     // settings
     bool set_CollectorMaxTemp(const char * value, const int8_t id);
@@ -28,9 +28,9 @@ class Switch : public EMSdevice {
     Switch(uint8_t device_type, uint8_t device_id, uint8_t product_id, const char * version, const char * name, uint8_t flags, uint8_t brand);
 
   private:
-    void process_WM10SetMessage(std::shared_ptr<const Telegram> telegram);
-    void process_WM10MonitorMessage(std::shared_ptr<const Telegram> telegram);
-    void process_WM10TempMessage(std::shared_ptr<const Telegram> telegram);
+    void process_WM10SetMessage(const Telegram & telegram);
+    void process_WM10MonitorMessage(const Telegram & telegram);
+    void process_WM10TempMessage(const Telegram & telegram);
 
     uint16_t flowTempHc_;
     uint8_t  status_;
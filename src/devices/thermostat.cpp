@@ -276,9 +276,9 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(const in
 // determine which heating circuit the type ID is referring too
 // returns pointer to the HeatingCircuit or nullptr if it can't be found
 // if its a new one, the heating circuit object will be created and also the fetch flags set
-std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::shared_ptr<const Telegram> telegram) {
+std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(const Telegram & telegram) {
     // do not create a hc on empty messages
-    if (telegram->message_length == 0) {
+    if (telegram.message_length == 0) {
         return nullptr;
     }
     // look through the Monitor and Set arrays to see if there is a match
@@ -286,15 +286,15 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     bool    toggle_ = false;
 
     // search device-id types for remote thermostats first, they have only a single typeid for all hcs
-    if (telegram->src >= 0x18 && telegram->src <= 0x1F) {
-        hc_num  = telegram->src - 0x17;
+    if (telegram.src >= 0x18 && telegram.src <= 0x1F) {
+        hc_num  = telegram.src - 0x17;
         toggle_ = true;
     }
 
     // not found, search monitor message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < monitor_typeids.size(); i++) {
-            if (monitor_typeids[i] == telegram->type_id) {
+            if (monitor_typeids[i] == telegram.type_id) {
                 hc_num  = i + 1;
                 toggle_ = true;
                 break;
@@ -305,7 +305,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search status message/set types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < set_typeids.size(); i++) {
-            if (set_typeids[i] == telegram->type_id) {
+            if (set_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -315,7 +315,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search set2 types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < set2_typeids.size(); i++) {
-            if (set2_typeids[i] == telegram->type_id) {
+            if (set2_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -325,7 +325,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search summer message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < summer_typeids.size(); i++) {
-            if (summer_typeids[i] == telegram->type_id) {
+            if (summer_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -335,7 +335,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search summer message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < summer2_typeids.size(); i++) {
-            if (summer2_typeids[i] == telegram->type_id) {
+            if (summer2_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -345,7 +345,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search heating_curve message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < curve_typeids.size(); i++) {
-            if (curve_typeids[i] == telegram->type_id) {
+            if (curve_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -355,7 +355,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search timer message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < timer_typeids.size(); i++) {
-            if (timer_typeids[i] == telegram->type_id) {
+            if (timer_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -365,7 +365,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search timer message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < timer2_typeids.size(); i++) {
-            if (timer2_typeids[i] == telegram->type_id) {
+            if (timer2_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -375,7 +375,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     // not found, search heatpump message types
     if (hc_num == 0) {
         for (uint8_t i = 0; i < hp_typeids.size(); i++) {
-            if (hp_typeids[i] == telegram->type_id) {
+            if (hp_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -384,7 +384,7 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
 
     if (hc_num == 0) {
         for (uint8_t i = 0; i < hpmode_typeids.size(); i++) {
-            if (hpmode_typeids[i] == telegram->type_id) {
+            if (hpmode_typeids[i] == telegram.type_id) {
                 hc_num = i + 1;
                 break;
             }
@@ -392,8 +392,8 @@ std::shared_ptr<Thermostat::HeatingCircuit> Thermostat::heating_circuit(std::sha
     }
 
     // not found, search device-id types for remote thermostats
-    if (hc_num == 0 && telegram->dest >= 0x20 && telegram->dest <= 0x27) {
-        hc_num = telegram->dest - 0x20;
+    if (hc_num == 0 && telegram.dest >= 0x20 && telegram.dest <= 0x27) {
+        hc_num = telegram.dest - 0x20;
     }
 
     // still didn't recognize it, ignore it
@@ -618,13 +618,13 @@ std::shared_ptr<Thermostat::DhwCircuit> Thermostat::dhw_circuit(const uint8_t of
 
 // type 0xB1 - data from the RC10 thermostat (0x17)
 // Data: 04 23 00 BA 00 00 00 BA
-void Thermostat::process_RC10Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC10Monitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
     }
     uint8_t mode = 1 << hc->mode;
-    telegram->read_value(mode, 0);           // 1: nofrost, 2: night, 4: day
+    telegram.read_value(mode, 0);           // 1: nofrost, 2: night, 4: day
     has_update(hc->mode, mode >> 1);         // store as enum 0, 1, 2
     has_update(telegram, hc->selTemp, 1, 1); // is * 2, force as single byte
     has_update(telegram, hc->roomTemp, 2);   // is * 10
@@ -635,7 +635,7 @@ void Thermostat::process_RC10Monitor(std::shared_ptr<const Telegram> telegram) {
 
 // type 0xB0 - for reading the mode from the RC10 thermostat (0x17)
 // Data: 00 FF 00 1C 20 08 01
-void Thermostat::process_RC10Set(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC10Set(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -652,19 +652,19 @@ void Thermostat::process_RC10Set(std::shared_ptr<const Telegram> telegram) {
 
 // type 0xB2, mode setting Data: 04 00
 // not used, we read mode from monitor 0xB1
-void Thermostat::process_RC10Set_2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC10Set_2(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
     }
     // uint8_t mode = 1 << hc->mode;
-    // telegram->read_value(mode, 0);           // 1: nofrost, 2: night, 4: day
+    // telegram.read_value(mode, 0);           // 1: nofrost, 2: night, 4: day
     // has_update(hc->mode, mode >> 1);          // store as enum 0, 1, 2
 }
 
 // 0xA8 - for reading the mode from the RC20 thermostat (0x17)
 // RC20Set(0xA8), data: 01 00 FF F6 01 06 00 01 0D 01 00 FF FF 01 02 02 02 00 00 05 1E 05 1E 02 1C 00 FF 00 00 26 02
-void Thermostat::process_RC20Set(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Set(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -677,7 +677,7 @@ void Thermostat::process_RC20Set(std::shared_ptr<const Telegram> telegram) {
 
 // 0x90 - for reading curve temperature from the RC20 thermostat (0x17)
 //
-void Thermostat::process_RC20Temp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Temp(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -693,18 +693,18 @@ void Thermostat::process_RC20Temp(std::shared_ptr<const Telegram> telegram) {
 // data: 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 (offset 27)
 // data: E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 90 E7 (offset 54)
 // data: 90 E7 90 01 00 00 01 01 00 01 01 00 01 01 00 01 01 00 00 (offset 81)
-void Thermostat::process_RC20Timer(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Timer(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
     }
-    if ((telegram->message_length == 2 && telegram->offset < 83 && !(telegram->offset & 1))
-        || (!telegram->offset && telegram->message_length > 1 && !strlen(hc->switchtime1))) {
+    if ((telegram.message_length == 2 && telegram.offset < 83 && !(telegram.offset & 1))
+        || (!telegram.offset && telegram.message_length > 1 && !strlen(hc->switchtime1))) {
         char    data[sizeof(hc->switchtime1)];
-        uint8_t no   = telegram->offset / 2;
-        uint8_t day  = telegram->message_data[0] >> 5;
-        uint8_t temp = telegram->message_data[0] & 7;
-        uint8_t time = telegram->message_data[1];
+        uint8_t no   = telegram.offset / 2;
+        uint8_t day  = telegram.message_data[0] >> 5;
+        uint8_t temp = telegram.message_data[0] & 7;
+        uint8_t time = telegram.message_data[1];
 
         // we use EN settings for the day abbreviation
         auto sday = FL_(enum_dayOfWeek)[day][0];
@@ -721,7 +721,7 @@ void Thermostat::process_RC20Timer(std::shared_ptr<const Telegram> telegram) {
 // type 0xAE - data from the RC20 thermostat (0x17) - not for RC20's
 // 17 00 AE 00 80 12 2E 00 D0 00 00 64 (#data=8)
 // https://github.com/emsesp/EMS-ESP/issues/361
-void Thermostat::process_RC20Monitor_2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Monitor_2(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -740,7 +740,7 @@ void Thermostat::process_RC20Monitor_2(std::shared_ptr<const Telegram> telegram)
 // offset: 01-nighttemp, 02-daytemp, 03-mode, 0B-program(1-9), 0D-setpoint_roomtemp(temporary)
 // 17 00 AD 00 01 27 29 01 4B 05 01 FF 28 19 0A 02 00 00
 // RC25(0x17) -> All(0x00), ?(0xAD), data: 01 27 2D 00 44 05 01 FF 28 19 0A 07 00 00 F6 12 5A 11 00 28 05 05 00
-void Thermostat::process_RC20Set_2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Set_2(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -760,19 +760,19 @@ void Thermostat::process_RC20Set_2(std::shared_ptr<const Telegram> telegram) {
 }
 
 // 0xAF - for reading the roomtemperature from the RC20/ES72 thermostat (0x18, 0x19, ..)
-void Thermostat::process_RC20Remote(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Remote(const Telegram & telegram) {
     has_update(telegram, tempsensor1_, 0);
 }
 
 // 0x42B - for reading the roomtemperature from the RC100H remote thermostat (0x38, 0x39, ..)
 // e.g. "38 10 FF 00 03 2B 00 D1 08 2A 01"
 // also RF temp from 0x435
-void Thermostat::process_RemoteTemp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RemoteTemp(const Telegram & telegram) {
     has_update(telegram, tempsensor1_, 0);
-    if (telegram->type_id >= 0x435) {
+    if (telegram.type_id >= 0x435) {
         return;
     }
-    uint8_t hc = telegram->type_id - 0x42B;
+    uint8_t hc = telegram.type_id - 0x42B;
     if (Roomctrl::is_remote(hc)) {
         toggle_fetch(0x273 + hc, false);
         toggle_fetch(0xA6A + hc, false);
@@ -781,14 +781,14 @@ void Thermostat::process_RemoteTemp(std::shared_ptr<const Telegram> telegram) {
 
 // 0x47B, ff - for reading humidity from the RC100H remote thermostat (0x38, 0x39, ..)
 // e.g. "38 10 FF 00 03 7B 08 24 00 4B"
-void Thermostat::process_RemoteHumidity(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RemoteHumidity(const Telegram & telegram) {
     // has_update(telegram, dewtemperature_, 0); // this is int8
     has_update(telegram, humidity_, 1);
     has_update(telegram, dewtemperature_, 2); // this is int16
     // some thermostats use short telegram with int8 dewpoint, https://github.com/emsesp/EMS-ESP32/issues/1491
-    if (telegram->offset == 0 && telegram->message_length < 4) {
+    if (telegram.offset == 0 && telegram.message_length < 4) {
         int8_t dew = dewtemperature_ / 10;
-        telegram->read_value(dew, 0);
+        telegram.read_value(dew, 0);
         if (dew != EMS_VALUE_INT8_NOTSET && dewtemperature_ != dew * 10) {
             dewtemperature_ = dew * 10;
             has_update(dewtemperature_);
@@ -798,17 +798,17 @@ void Thermostat::process_RemoteHumidity(std::shared_ptr<const Telegram> telegram
 
 // 0x273 - for reading temperaturcorrection from the RC100H remote thermostat (0x38, 0x39, ..)
 // Thermostat(0x38) -> Me(0x0B), RemoteCorrection(0x0273), data: 0A 00
-void Thermostat::process_RemoteCorrection(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RemoteCorrection(const Telegram & telegram) {
     has_update(telegram, ibaCalIntTemperature_, 0);
 }
 
 // 0xA6A - for reading battery from the RC100H remote thermostat (0x38, 0x39, ..)
-void Thermostat::process_RemoteBattery(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RemoteBattery(const Telegram & telegram) {
     has_update(telegram, battery_, 1);
 }
 
 // type 0x0165, ff
-void Thermostat::process_JunkersSet(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersSet(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -836,7 +836,7 @@ void Thermostat::process_JunkersSet(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x0179, ff for Junkers_OLD
-void Thermostat::process_JunkersSet2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersSet2(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -856,12 +856,12 @@ void Thermostat::process_JunkersSet2(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x123 - FB10 Junkers remote
-void Thermostat::process_JunkersRemoteMonitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersRemoteMonitor(const Telegram & telegram) {
     has_update(telegram, tempsensor1_, 0); // roomTemp from remote
 }
 
 // type 0xA3 - for external temp settings from the the RC* thermostats (e.g. RC35)
-void Thermostat::process_RCOutdoorTemp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RCOutdoorTemp(const Telegram & telegram) {
     has_update(telegram, dampedoutdoortemp_, 0);
     has_update(telegram, tempsensor1_, 3); // sensor 1 - is * 10
     has_update(telegram, tempsensor2_, 5); // sensor 2 - is * 10
@@ -870,7 +870,7 @@ void Thermostat::process_RCOutdoorTemp(std::shared_ptr<const Telegram> telegram)
 // 0x91 - data from the RC20 thermostat (0x17) - 15 bytes long
 // RC20Monitor(0x91), data: 90 2A 00 D5 1A 00 00 05 00 5A 04 00 D6 00
 // offset 8: setburnpower to boiler, offset 9: setflowtemp to boiler (thermostat: targetflowtemp) send via 0x1A
-void Thermostat::process_RC20Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC20Monitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -883,28 +883,28 @@ void Thermostat::process_RC20Monitor(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x0A - data from the Nefit Easy/TC100 thermostat (0x18) - 31 bytes long
-void Thermostat::process_EasyMonitor(std::shared_ptr<const Telegram> telegram) {
-    monitor_typeids[0] = telegram->type_id;
+void Thermostat::process_EasyMonitor(const Telegram & telegram) {
+    monitor_typeids[0] = telegram.type_id;
     auto hc            = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
     }
 
-    if (telegram->type_id == 0x0A) {
+    if (telegram.type_id == 0x0A) {
         int16_t temp = hc->roomTemp;
-        if (telegram->read_value(temp, 8) && temp != 0) {
+        if (telegram.read_value(temp, 8) && temp != 0) {
             has_update(telegram, hc->roomTemp, 8); // is * 100
             has_update(telegram, hc->selTemp, 10); // is * 100
             toggle_fetch(0x0A, true);
         }
-    } else if (telegram->type_id == 0x02A5) { // see #2277
+    } else if (telegram.type_id == 0x02A5) { // see #2277
         int16_t temp = hc->roomTemp / 10;
-        if (telegram->read_value(temp, 0)) {     // is * 10
+        if (telegram.read_value(temp, 0)) {     // is * 10
             has_update(hc->roomTemp, temp * 10); // * 100
             toggle_fetch(0x0A, false);
         }
         int16_t sel = hc->selTemp / 50;
-        if (telegram->read_value(sel, 6, 1)) { // is * 2
+        if (telegram.read_value(sel, 6, 1)) { // is * 2
             has_update(hc->selTemp, sel * 50); // * 100
         }
     }
@@ -913,7 +913,7 @@ void Thermostat::process_EasyMonitor(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Settings Parameters - 0xA5 - RC30_1
-void Thermostat::process_IBASettings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_IBASettings(const Telegram & telegram) {
     // 22 - display line on RC35
 
     // display on Thermostat: 0 int. temp, 1 int. setpoint, 2 ext. temp., 3 burner temp., 4 ww temp, 5 functioning mode, 6 time, 7 data, 8 smoke temp
@@ -927,7 +927,7 @@ void Thermostat::process_IBASettings(std::shared_ptr<const Telegram> telegram) {
 }
 
 // Settings WW 0x37 - RC35
-void Thermostat::process_RC35wwSettings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC35wwSettings(const Telegram & telegram) {
     auto dhw = dhw_circuit(0, true);
     has_bitupdate(telegram, dhw->wwProgMode_, 0, 0); // 0-like hc, 0xFF own prog
     has_bitupdate(telegram, dhw->wwCircProg_, 1, 0); // 0-like hc, 0xFF own prog
@@ -941,7 +941,7 @@ void Thermostat::process_RC35wwSettings(std::shared_ptr<const Telegram> telegram
 }
 
 // Settings WW 0x3A - RC30
-void Thermostat::process_RC30wwSettings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC30wwSettings(const Telegram & telegram) {
     auto dhw = dhw_circuit(0, true);
     has_update(telegram, dhw->wwMode_, 0);         // 0-on, 1-off, 2-auto
     has_update(telegram, dhw->wwWhenModeOff_, 1);  // 0-off, 0xFF on
@@ -951,15 +951,15 @@ void Thermostat::process_RC30wwSettings(std::shared_ptr<const Telegram> telegram
 }
 
 // type 0x38 (ww) and 0x39 (circ)
-void Thermostat::process_RC35wwTimer(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC35wwTimer(const Telegram & telegram) {
     auto dhw = dhw_circuit(0, true);
-    if ((telegram->message_length == 2 && telegram->offset < 83 && !(telegram->offset & 1))
-        || (!telegram->offset && telegram->type_id == 0x38 && !strlen(dhw->wwSwitchTime_) && telegram->message_length > 1)
-        || (!telegram->offset && telegram->type_id == 0x39 && !strlen(dhw->wwCircSwitchTime_) && telegram->message_length > 1)) {
-        uint8_t no   = telegram->offset / 2;
-        uint8_t day  = telegram->message_data[0] >> 5;
-        uint8_t on   = telegram->message_data[0] & 1;
-        uint8_t time = telegram->message_data[1];
+    if ((telegram.message_length == 2 && telegram.offset < 83 && !(telegram.offset & 1))
+        || (!telegram.offset && telegram.type_id == 0x38 && !strlen(dhw->wwSwitchTime_) && telegram.message_length > 1)
+        || (!telegram.offset && telegram.type_id == 0x39 && !strlen(dhw->wwCircSwitchTime_) && telegram.message_length > 1)) {
+        uint8_t no   = telegram.offset / 2;
+        uint8_t day  = telegram.message_data[0] >> 5;
+        uint8_t on   = telegram.message_data[0] & 1;
+        uint8_t time = telegram.message_data[1];
 
         char data[sizeof(dhw->wwSwitchTime_)];
         // we use EN settings for the day abbreviation
@@ -969,54 +969,54 @@ void Thermostat::process_RC35wwTimer(std::shared_ptr<const Telegram> telegram) {
         } else {
             snprintf(data, sizeof(data), "%02d %s %02d:%02d %s", no, sday, time / 6, 10 * (time % 6), on ? "on" : "off");
         }
-        if (telegram->type_id == 0x38) {
+        if (telegram.type_id == 0x38) {
             has_update(dhw->wwSwitchTime_, data, sizeof(dhw->wwSwitchTime_));
         } else {
             has_update(dhw->wwCircSwitchTime_, data, sizeof(dhw->wwCircSwitchTime_));
         }
-        if (is_fetch(telegram->type_id)) {
-            toggle_fetch(telegram->type_id, false); // dont fetch again
+        if (is_fetch(telegram.type_id)) {
+            toggle_fetch(telegram.type_id, false); // dont fetch again
         }
     }
 
     // vacation/holiday only from dhw timer
-    if (telegram->type_id != 0x38) {
+    if (telegram.type_id != 0x38) {
         return;
     }
 
-    if (telegram->message_length + telegram->offset >= 92 && telegram->offset <= 87) {
+    if (telegram.message_length + telegram.offset >= 92 && telegram.offset <= 87) {
         char data[sizeof(dhw->wwVacation_) + 4]; // avoid compiler warning
         snprintf(data,
                  sizeof(data),
                  "%02d.%02d.%04d-%02d.%02d.%04d",
-                 telegram->message_data[87 - telegram->offset],
-                 telegram->message_data[88 - telegram->offset],
-                 telegram->message_data[89 - telegram->offset] + 2000,
-                 telegram->message_data[90 - telegram->offset],
-                 telegram->message_data[91 - telegram->offset],
-                 telegram->message_data[92 - telegram->offset] + 2000);
+                 telegram.message_data[87 - telegram.offset],
+                 telegram.message_data[88 - telegram.offset],
+                 telegram.message_data[89 - telegram.offset] + 2000,
+                 telegram.message_data[90 - telegram.offset],
+                 telegram.message_data[91 - telegram.offset],
+                 telegram.message_data[92 - telegram.offset] + 2000);
         has_update(dhw->wwVacation_, data, sizeof(dhw->wwVacation_));
     }
 
-    if (telegram->message_length + telegram->offset >= 98 && telegram->offset <= 93) {
+    if (telegram.message_length + telegram.offset >= 98 && telegram.offset <= 93) {
         char data[sizeof(dhw->wwHoliday_) + 4]; // avoid compiler warning
         snprintf(data,
                  sizeof(data),
                  "%02d.%02d.%04d-%02d.%02d.%04d",
-                 telegram->message_data[93 - telegram->offset],
-                 telegram->message_data[94 - telegram->offset],
-                 telegram->message_data[95 - telegram->offset] + 2000,
-                 telegram->message_data[96 - telegram->offset],
-                 telegram->message_data[97 - telegram->offset],
-                 telegram->message_data[98 - telegram->offset] + 2000);
+                 telegram.message_data[93 - telegram.offset],
+                 telegram.message_data[94 - telegram.offset],
+                 telegram.message_data[95 - telegram.offset] + 2000,
+                 telegram.message_data[96 - telegram.offset],
+                 telegram.message_data[97 - telegram.offset],
+                 telegram.message_data[98 - telegram.offset] + 2000);
         has_update(dhw->wwHoliday_, data, sizeof(dhw->wwHoliday_));
     }
 }
 
 // type 0x6F - FR10/FR50/FR100/FR110/FR120 Junkers
-void Thermostat::process_JunkersMonitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersMonitor(const Telegram & telegram) {
     // ignore single byte telegram messages
-    if (telegram->message_length <= 1) {
+    if (telegram.message_length <= 1) {
         return;
     }
 
@@ -1039,7 +1039,7 @@ void Thermostat::process_JunkersMonitor(std::shared_ptr<const Telegram> telegram
 
 // 0xBB Heatpump optimization
 // ?(0xBB), data: 00 00 00 00 00 00 00 00 00 00 00 FF 02 0F 1E 0B 1A 00 14 03
-void Thermostat::process_HybridSettings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_HybridSettings(const Telegram & telegram) {
     has_enumupdate(telegram, hybridStrategy_, 12, 1); // cost = 2, temperature = 3, mix = 4
     has_update(telegram, switchOverTemp_, 13);        // full degrees
     has_update(telegram, energyCostRatio_, 14);       // is *10
@@ -1050,18 +1050,18 @@ void Thermostat::process_HybridSettings(std::shared_ptr<const Telegram> telegram
 }
 
 // 0x23E PV settings
-void Thermostat::process_PVSettings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_PVSettings(const Telegram & telegram) {
     has_update(telegram, pvRaiseHeat_, 0);
     has_update(telegram, pvEnableWw_, 3);
     has_update(telegram, pvLowerCool_, 5);
 }
 
 // 0x16E Absent settings - hc or dhw or device_data? #1957
-void Thermostat::process_Absent(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_Absent(const Telegram & telegram) {
     has_update(telegram, absent_, 0);
 }
 
-void Thermostat::process_JunkersSetMixer(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersSetMixer(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1070,19 +1070,19 @@ void Thermostat::process_JunkersSetMixer(std::shared_ptr<const Telegram> telegra
 }
 
 // Thermostat(0x10) -> All(0x00), ?(0x01D3), data: 01 00 00
-void Thermostat::process_JunkersWW(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersWW(const Telegram & telegram) {
     auto dhw = dhw_circuit(0, true);
     has_bitupdate(telegram, dhw->wwCharge_, 0, 3);
 }
 
 // 0x11E
-void Thermostat::process_JunkersDisp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_JunkersDisp(const Telegram & telegram) {
     has_enumupdate(telegram, ibaMainDisplay_, 1, 1);
     has_update(telegram, ibaLanguage_, 3);
 }
 
 // type 0x02A5 - data from Worchester CRF200
-void Thermostat::process_CRFMonitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_CRFMonitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1098,7 +1098,7 @@ void Thermostat::process_CRFMonitor(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x02A5 - data from CR11
-void Thermostat::process_CR11Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_CR11Monitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1119,7 +1119,7 @@ void Thermostat::process_CR11Monitor(std::shared_ptr<const Telegram> telegram) {
 
 // type 0x02A5 - data from the Nefit RC1010/3000 thermostat (0x18) and RC300/310s on 0x10
 // Rx: 10 0B FF 00 01 A5 80 00 01 30 23 00 30 28 01 E7 03 03 01 01 E7 02 33 00 00 11 01 03 FF FF 00 04
-void Thermostat::process_RC300Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Monitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1140,7 +1140,7 @@ void Thermostat::process_RC300Monitor(std::shared_ptr<const Telegram> telegram)
     has_update(telegram, hc->selTemp, 3, 1); // is * 2, force as single byte
     // has_bitupdate(telegram, hc->summermode, 2, 4);
     // summermode is bit 4 for boilers and bit 6 for heatpumps: 0:winter, 1:summer
-    telegram->read_value(hc->statusbyte, 2);
+    telegram.read_value(hc->statusbyte, 2);
     // use summertemp or hpoperatingstate, https://github.com/emsesp/EMS-ESP32/issues/747, #550, #503
     if ((hc->statusbyte & 1) || !is_received(summer2_typeids[hc->hc()])) {
         has_update(hc->summermode, hc->statusbyte & 0x50 ? 1 : 0);
@@ -1160,7 +1160,7 @@ void Thermostat::process_RC300Monitor(std::shared_ptr<const Telegram> telegram)
 
 // type 0x02B9 EMS+ for reading from RC300/RC310 thermostat
 // Thermostat(0x10) -> Me(0x0B), RC300Set(0x2B9), data: FF 2E 2A 26 1E 02 4E FF FF 00 1C 01 E1 20 01 0F 05 00 00 02 1F
-void Thermostat::process_RC300Set(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Set(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr || model() == EMSdevice::EMS_DEVICE_FLAG_CR11) {
         return;
@@ -1185,7 +1185,7 @@ void Thermostat::process_RC300Set(std::shared_ptr<const Telegram> telegram) {
     // manipulate tempautotemp to show -1°C (with scale 0.5°C) if value is 0xFF
     // see https://github.com/emsesp/EMS-ESP32/issues/321
     int8_t tat = hc->tempautotemp;
-    telegram->read_value(tat, 8);
+    telegram.read_value(tat, 8);
     if ((uint8_t)tat == 0xFF) {
         tat = -2;
     }
@@ -1211,7 +1211,7 @@ void Thermostat::process_RC300Set(std::shared_ptr<const Telegram> telegram) {
 
 // types 0x2AF ff
 // RC300Summer(0x02AF), data: 00 28 00 00 3C 26 00 00 19 0F 00 (from a heatpump)
-void Thermostat::process_RC300Summer(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Summer(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1239,7 +1239,7 @@ void Thermostat::process_RC300Summer(std::shared_ptr<const Telegram> telegram) {
 
 // types 0x471 ff summer2_typeids
 // (0x473), data: 00 11 04 01 01 1C 08 04
-void Thermostat::process_RC300Summer2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Summer2(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1262,7 +1262,7 @@ void Thermostat::process_RC300Summer2(std::shared_ptr<const Telegram> telegram)
 
 // types 0x29B ff
 // Thermostat(0x10) -> Me(0x0B), RC300Curves(0x29B), data: 01 01 00 FF FF 01 05 30 52
-void Thermostat::process_RC300Curve(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Curve(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1282,7 +1282,7 @@ void Thermostat::process_RC300Curve(std::shared_ptr<const Telegram> telegram) {
 }
 
 // types 0x31B
-void Thermostat::process_RC300WWtemp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300WWtemp(const Telegram & telegram) {
     auto dhw = dhw_circuit(0, true);
     has_update(telegram, dhw->wwSetTemp_, 0);
     has_update(telegram, dhw->wwSetTempLow_, 1);
@@ -1291,10 +1291,10 @@ void Thermostat::process_RC300WWtemp(std::shared_ptr<const Telegram> telegram) {
 // type 02F5
 // RC300WWmode(0x2F5), data: 01 FF 04 00 00 00 08 05 00 08 04 00 00 00 00 00 00 00 00 00 01
 // RC300WWmode(0x2F6), data: 02 FF 04 00 00 00 08 05 00 08 04 00 00 00 00 00 00 00 00 00 01
-void Thermostat::process_RC300WWmode(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300WWmode(const Telegram & telegram) {
     uint8_t circuit = 0;
-    telegram->read_value(circuit, 0); // 00-no circuit, 01-boiler, 02-mixer
-    auto dhw = dhw_circuit(telegram->type_id - 0x2F5, circuit != 0);
+    telegram.read_value(circuit, 0); // 00-no circuit, 01-boiler, 02-mixer
+    auto dhw = dhw_circuit(telegram.type_id - 0x2F5, circuit != 0);
     if (dhw == nullptr) {
         return;
     }
@@ -1325,8 +1325,8 @@ void Thermostat::process_RC300WWmode(std::shared_ptr<const Telegram> telegram) {
 
 // types 0x31D and 0x31E
 // RC300WWmode2(0x31D), data: 00 00 09 07
-void Thermostat::process_RC300WWmode2(std::shared_ptr<const Telegram> telegram) {
-    auto dhw = dhw_circuit(telegram->type_id - 0x31D);
+void Thermostat::process_RC300WWmode2(const Telegram & telegram) {
+    auto dhw = dhw_circuit(telegram.type_id - 0x31D);
     if (dhw == nullptr) {
         return;
     }
@@ -1339,13 +1339,13 @@ void Thermostat::process_RC300WWmode2(std::shared_ptr<const Telegram> telegram)
 }
 
 // 0x23A damped outdoor temp
-void Thermostat::process_RC300OutdoorTemp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300OutdoorTemp(const Telegram & telegram) {
     has_update(telegram, dampedoutdoortemp2_, 0); // is *10
 }
 
 // 0x240 RC300 parameter, 0x0241 for CW100, see https://github.com/emsesp/EMS-ESP32/issues/2290
 // RC300Settings(0x240), data: 26 00 03 00 00 00 00 00 FF 01 F6 06 FF 00 00 00 00 00 00 00 00 00 00
-void Thermostat::process_RC300Settings(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Settings(const Telegram & telegram) {
     has_update(telegram, ibaCalIntTemperature_, 7);
     has_update(telegram, ibaDamping_, 8);
     has_enumupdate(telegram, ibaBuildingType_, 9, 1); // 1=light, 2=medium, 3=heavy
@@ -1354,7 +1354,7 @@ void Thermostat::process_RC300Settings(std::shared_ptr<const Telegram> telegram)
 }
 
 // 0x2CC - e.g. wwprio for  RC310 hcx parameter
-void Thermostat::process_RC300Set2(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Set2(const Telegram & telegram) {
     // typeids are not in a row.  hc:0x2CC, hc2: 0x2CE  for RC310
     // telegram is either offset 3 with data length of 1 and values 0/1 (radiators) - 10 0B FF 03 01 CC 01 F6
     // or offset 0 with data length of 6 bytes - offset 3 values are 0x00 or 0xFF - 10 0B FF 00 01 CE FF 13 0A FF 1E 00 20
@@ -1367,32 +1367,32 @@ void Thermostat::process_RC300Set2(std::shared_ptr<const Telegram> telegram) {
 }
 
 // 0x267 RC300 floordrying
-void Thermostat::process_RC300Floordry(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC300Floordry(const Telegram & telegram) {
     has_update(telegram, floordrystatus_, 0);
     has_update(telegram, floordrytemp_, 1);
 }
 
 // 0x269 - 0x26D  RC300 EMS+ holidaymodes 1 to 5
 // special case R3000 only date in 0x269, CR50 only 0x043F
-void Thermostat::process_RC300Holiday(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset || telegram->message_length < 6) {
+void Thermostat::process_RC300Holiday(const Telegram & telegram) {
+    if (telegram.offset || telegram.message_length < 6) {
         return;
     }
     char data[sizeof(vacation[0]) + 4];
     snprintf(data,
              sizeof(data),
              "%02d.%02d.%04d-%02d.%02d.%04d",
-             telegram->message_data[2],
-             telegram->message_data[1],
-             telegram->message_data[0] + 2000,
-             telegram->message_data[5],
-             telegram->message_data[4],
-             telegram->message_data[3] + 2000);
+             telegram.message_data[2],
+             telegram.message_data[1],
+             telegram.message_data[0] + 2000,
+             telegram.message_data[5],
+             telegram.message_data[4],
+             telegram.message_data[3] + 2000);
     has_update(vacation[0], data, sizeof(vacation[0]));
 }
 
 // https://github.com/emsesp/EMS-ESP32/issues/2735#issuecomment-3520124647
-void Thermostat::process_PID(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_PID(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1412,7 +1412,7 @@ void Thermostat::process_PID(std::shared_ptr<const Telegram> telegram) {
 
 // 0x291 ff.  HP mode
 // thermostat(0x10) -W-> Me(0x0B), HPMode(0x0291), data: 01 00 00 03 FF 00
-void Thermostat::process_HPMode(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_HPMode(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1422,7 +1422,7 @@ void Thermostat::process_HPMode(std::shared_ptr<const Telegram> telegram) {
 }
 
 // 0x467 ff HP settings
-void Thermostat::process_HPSet(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_HPSet(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1434,7 +1434,7 @@ void Thermostat::process_HPSet(std::shared_ptr<const Telegram> telegram) {
 
 // type 0x41 - data from the RC30 thermostat(0x10) - 14 bytes long
 // RC30Monitor(0x41), data: 80 20 00 AC 00 00 00 02 00 05 09 00 AC 00
-void Thermostat::process_RC30Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC30Monitor(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1449,7 +1449,7 @@ void Thermostat::process_RC30Monitor(std::shared_ptr<const Telegram> telegram) {
 // type 0xA7 - for reading the mode from the RC30 thermostat (0x10) and all the installation settings
 // RC30Set(0xA7), data: 01 00 FF F6 01 06 00 01 0D 00 00 FF FF 01 02 02 02 00 00 05 1F 05 1F 01 0E 00 FF
 // RC30Set(0xA7), data: 00 00 20 02 (offset 27)
-void Thermostat::process_RC30Set(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC30Set(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
@@ -1472,9 +1472,9 @@ void Thermostat::process_RC30Set(std::shared_ptr<const Telegram> telegram) {
 
 // type 0x40 (HC1) - for reading the operating mode from the RC30 thermostat (0x10)
 // RC30Temp(0x40), data: 01 01 02 20 24 28 2A 1E 0E 00 01 5A 32 05 4B 2D 00 28 00 3C FF 11 00 05 00
-void Thermostat::process_RC30Temp(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC30Temp(const Telegram & telegram) {
     // check to see we have a valid type. heating: 1 radiator, 2 convectors, 3 floors
-    if (telegram->offset == 0 && telegram->message_data[0] == 0x00) {
+    if (telegram.offset == 0 && telegram.message_data[0] == 0x00) {
         return;
     }
 
@@ -1493,11 +1493,11 @@ void Thermostat::process_RC30Temp(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x3E (HC1), 0x48 (HC2), 0x52 (HC3), 0x5C (HC4) - data from the RC35 thermostat (0x10) - 16 bytes
-void Thermostat::process_RC35Monitor(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC35Monitor(const Telegram & telegram) {
     // Check if heatingciruit is active, see https://github.com/emsesp/EMS-ESP32/issues/786
     // roomtemp is measured value or 7D00 on active hc's, zero on inactive
     uint16_t active = 0;
-    if (!telegram->read_value(active, 3)) {
+    if (!telegram.read_value(active, 3)) {
         return;
     }
 
@@ -1519,9 +1519,9 @@ void Thermostat::process_RC35Monitor(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x3D (HC1), 0x47 (HC2), 0x51 (HC3), 0x5B (HC4) - Working Mode Heating - for reading the mode from the RC35 thermostat (0x10)
-void Thermostat::process_RC35Set(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC35Set(const Telegram & telegram) {
     // check to see we have a valid type. heating: 1 radiator, 2 convectors, 3 floors, 4 room supply
-    if (telegram->offset == 0 && telegram->message_data[0] == 0x00) {
+    if (telegram.offset == 0 && telegram.message_data[0] == 0x00) {
         return;
     }
 
@@ -1567,21 +1567,21 @@ void Thermostat::process_RC35Set(std::shared_ptr<const Telegram> telegram) {
 }
 
 // type 0x3F (HC1), 0x49 (HC2), 0x53 (HC3), 0x5D (HC4) - timer setting
-void Thermostat::process_RC35Timer(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_RC35Timer(const Telegram & telegram) {
     auto hc = heating_circuit(telegram);
     if (hc == nullptr) {
         return;
     }
 
-    uint8_t prog = telegram->type_id == timer_typeids[hc->hc()] ? 0 : 1;
-    if ((telegram->message_length == 2 && telegram->offset < 83 && !(telegram->offset & 1))
-        || (!telegram->offset && telegram->message_length > 1 && !prog && !strlen(hc->switchtime1))
-        || (!telegram->offset && telegram->message_length > 1 && prog && !strlen(hc->switchtime2))) {
+    uint8_t prog = telegram.type_id == timer_typeids[hc->hc()] ? 0 : 1;
+    if ((telegram.message_length == 2 && telegram.offset < 83 && !(telegram.offset & 1))
+        || (!telegram.offset && telegram.message_length > 1 && !prog && !strlen(hc->switchtime1))
+        || (!telegram.offset && telegram.message_length > 1 && prog && !strlen(hc->switchtime2))) {
         char    data[sizeof(hc->switchtime1)];
-        uint8_t no   = telegram->offset / 2;
-        uint8_t day  = telegram->message_data[0] >> 5;
-        uint8_t on   = model() == EMSdevice::EMS_DEVICE_FLAG_RC30 ? telegram->message_data[0] & 7 : telegram->message_data[0] & 1;
-        uint8_t time = telegram->message_data[1];
+        uint8_t no   = telegram.offset / 2;
+        uint8_t day  = telegram.message_data[0] >> 5;
+        uint8_t on   = model() == EMSdevice::EMS_DEVICE_FLAG_RC30 ? telegram.message_data[0] & 7 : telegram.message_data[0] & 1;
+        uint8_t time = telegram.message_data[1];
 
         // we use EN settings for the day abbreviation
         auto sday = (FL_(enum_dayOfWeek)[day][0]);
@@ -1598,8 +1598,8 @@ void Thermostat::process_RC35Timer(std::shared_ptr<const Telegram> telegram) {
         } else {
             strlcpy(hc->switchtime2, data, sizeof(hc->switchtime2));
             has_update(hc->switchtime2);
-            if (is_fetch(telegram->type_id)) {
-                toggle_fetch(telegram->type_id, false);
+            if (is_fetch(telegram.type_id)) {
+                toggle_fetch(telegram.type_id, false);
             }
         }
     }
@@ -1608,42 +1608,42 @@ void Thermostat::process_RC35Timer(std::shared_ptr<const Telegram> telegram) {
     has_update(telegram, hc->pause, 85);   // time in hours
     has_update(telegram, hc->party, 86);   // time in hours
 
-    if (telegram->message_length + telegram->offset >= 92 && telegram->offset <= 87) {
+    if (telegram.message_length + telegram.offset >= 92 && telegram.offset <= 87) {
         char data[sizeof(hc->vacation) + 4]; // avoid compiler warning
         snprintf(data,
                  sizeof(data),
                  "%02d.%02d.%04d-%02d.%02d.%04d",
-                 telegram->message_data[87 - telegram->offset],
-                 telegram->message_data[88 - telegram->offset],
-                 telegram->message_data[89 - telegram->offset] + 2000,
-                 telegram->message_data[90 - telegram->offset],
-                 telegram->message_data[91 - telegram->offset],
-                 telegram->message_data[92 - telegram->offset] + 2000);
+                 telegram.message_data[87 - telegram.offset],
+                 telegram.message_data[88 - telegram.offset],
+                 telegram.message_data[89 - telegram.offset] + 2000,
+                 telegram.message_data[90 - telegram.offset],
+                 telegram.message_data[91 - telegram.offset],
+                 telegram.message_data[92 - telegram.offset] + 2000);
         has_update(hc->vacation, data, sizeof(hc->vacation));
     }
 
-    if (telegram->message_length + telegram->offset >= 98 && telegram->offset <= 93) {
+    if (telegram.message_length + telegram.offset >= 98 && telegram.offset <= 93) {
         char data[sizeof(hc->holiday) + 4]; // avoid compiler warning
         snprintf(data,
                  sizeof(data),
                  "%02d.%02d.%04d-%02d.%02d.%04d",
-                 telegram->message_data[93 - telegram->offset],
-                 telegram->message_data[94 - telegram->offset],
-                 telegram->message_data[95 - telegram->offset] + 2000,
-                 telegram->message_data[96 - telegram->offset],
-                 telegram->message_data[97 - telegram->offset],
-                 telegram->message_data[98 - telegram->offset] + 2000);
+                 telegram.message_data[93 - telegram.offset],
+                 telegram.message_data[94 - telegram.offset],
+                 telegram.message_data[95 - telegram.offset] + 2000,
+                 telegram.message_data[96 - telegram.offset],
+                 telegram.message_data[97 - telegram.offset],
+                 telegram.message_data[98 - telegram.offset] + 2000);
         has_update(hc->holiday, data, sizeof(hc->holiday));
     }
 }
 
 // type 0x9A (HC1)
-void Thermostat::process_RC30Vacation(std::shared_ptr<const Telegram> telegram) {
-    if ((telegram->offset + telegram->message_length) > 57) {
+void Thermostat::process_RC30Vacation(const Telegram & telegram) {
+    if ((telegram.offset + telegram.message_length) > 57) {
         return;
     }
     static uint8_t vacation_telegram[57] = {0}; // make a copy of the whole telegram to access blocks
-    memcpy(&vacation_telegram[telegram->offset], telegram->message_data, telegram->message_length);
+    memcpy(&vacation_telegram[telegram.offset], telegram.message_data, telegram.message_length);
     for (uint8_t index = 0, pos = 0; index < 8; index++, pos += 7) {
         char data[sizeof(vacation[0]) + 4]; // avoid compiler warning
         snprintf(data,
@@ -1662,8 +1662,8 @@ void Thermostat::process_RC30Vacation(std::shared_ptr<const Telegram> telegram)
 }
 
 // process_RCTime - type 0x06 - date and time from a thermostat - 12 or 15 bytes long
-void Thermostat::process_RCTime(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 8) {
+void Thermostat::process_RCTime(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 8) {
         return;
     }
 
@@ -1673,8 +1673,8 @@ void Thermostat::process_RCTime(std::shared_ptr<const Telegram> telegram) {
 
     static uint8_t setTimeRetry = 0;
     uint8_t        dst          = 0xFE;
-    bool           use_dst      = !telegram->read_value(dst, 9) || dst == 0xFF;
-    if ((telegram->message_data[7] & 0x0C) && has_command(&dateTime_)) { // date and time not valid
+    bool           use_dst      = !telegram.read_value(dst, 9) || dst == 0xFF;
+    if ((telegram.message_data[7] & 0x0C) && has_command(&dateTime_)) { // date and time not valid
         if (setTimeRetry < 3) {
             if (!use_dst) {
                 set_datetime("ntp", 0); // set from NTP without dst
@@ -1690,14 +1690,14 @@ void Thermostat::process_RCTime(std::shared_ptr<const Telegram> telegram) {
     time_t now   = time(nullptr);
     tm *   tm_   = localtime(&now);
     bool   tset_ = tm_->tm_year > 110;                       // year 2010 and up, time is valid
-    tm_->tm_year = (telegram->message_data[0] & 0x7F) + 100; // IVT
-    tm_->tm_mon  = telegram->message_data[1] - 1;
-    tm_->tm_mday = telegram->message_data[3];
-    tm_->tm_hour = telegram->message_data[2];
-    tm_->tm_min  = telegram->message_data[4];
-    tm_->tm_sec  = telegram->message_data[5];
+    tm_->tm_year = (telegram.message_data[0] & 0x7F) + 100; // IVT
+    tm_->tm_mon  = telegram.message_data[1] - 1;
+    tm_->tm_mday = telegram.message_data[3];
+    tm_->tm_hour = telegram.message_data[2];
+    tm_->tm_min  = telegram.message_data[4];
+    tm_->tm_sec  = telegram.message_data[5];
     if (use_dst) {
-        tm_->tm_isdst = telegram->message_data[7] & 0x01;
+        tm_->tm_isdst = telegram.message_data[7] & 0x01;
     }
 
     // render date to DD.MM.YYYY HH:MM and publish
@@ -1705,7 +1705,7 @@ void Thermostat::process_RCTime(std::shared_ptr<const Telegram> telegram) {
     strftime(newdatetime, sizeof(dateTime_), "%d.%m.%Y %H:%M", tm_);
     has_update(dateTime_, newdatetime, sizeof(dateTime_));
 
-    bool   ivtclock     = (telegram->message_data[0] & 0x80) == 0x80; // dont sync ivt-clock, #439
+    bool   ivtclock     = (telegram.message_data[0] & 0x80) == 0x80; // dont sync ivt-clock, #439
     bool   junkersclock = model() == EMSdevice::EMS_DEVICE_FLAG_JUNKERS;
     time_t ttime        = mktime(tm_); // thermostat time
     // correct thermostat clock if we have valid ntp time, and could write the command
@@ -1742,16 +1742,16 @@ void Thermostat::process_RCTime(std::shared_ptr<const Telegram> telegram) {
 // process_RCError - type 0xA2 - error message - 14 bytes long
 // 10 00 A2 00 41 32 32 03 30 00 02 00 00 00 00 00 00 02 CRC
 //              A  2  2  816
-void Thermostat::process_RCError(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 5) {
+void Thermostat::process_RCError(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 5) {
         return;
     }
 
-    telegram->read_value(errorNumber_, 3);
+    telegram.read_value(errorNumber_, 3);
     char code[sizeof(errorCode_)];
-    code[0] = telegram->message_data[0];
-    code[1] = telegram->message_data[1];
-    code[2] = telegram->message_data[2];
+    code[0] = telegram.message_data[0];
+    code[1] = telegram.message_data[1];
+    code[2] = telegram.message_data[2];
     snprintf(&code[3], sizeof(code) - 3, "(%d)", errorNumber_);
     has_update(errorCode_, code, sizeof(errorCode_));
 }
@@ -1759,28 +1759,28 @@ void Thermostat::process_RCError(std::shared_ptr<const Telegram> telegram) {
 // 0x12 and 0x13 error log
 // RCErrorMessage(0x12), data: 32 32 03 30 95 0A 0A 15 18 00 01 19 32 32 03 30 95 0A 09 05 18 00 01 19 31 38 03
 // RCErrorMessage(0x12), data: 39 95 08 09 0F 19 00 01 17 64 31 03 34 95 07 10 08 00 00 01 70 (offset 27)
-void Thermostat::process_RCErrorMessage(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 11) {
+void Thermostat::process_RCErrorMessage(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 11) {
         return;
     }
 
     // data: displaycode(2), errornumber(2), year, month, hour, day, minute, duration(2), src-addr
-    if (telegram->message_data[4] & 0x80) {          // valid date
+    if (telegram.message_data[4] & 0x80) {          // valid date
         static uint32_t lastCodeDate_           = 0; // last code date
         char            code[sizeof(lastCode_)] = {0};
         uint16_t        codeNo                  = EMS_VALUE_UINT16_NOTSET;
-        code[0]                                 = telegram->message_data[0];
-        code[1]                                 = telegram->message_data[1];
+        code[0]                                 = telegram.message_data[0];
+        code[1]                                 = telegram.message_data[1];
         code[2]                                 = 0;
-        telegram->read_value(codeNo, 2);
-        uint16_t year     = (telegram->message_data[4] & 0x7F) + 2000;
-        uint8_t  month    = telegram->message_data[5];
-        uint8_t  day      = telegram->message_data[7];
-        uint8_t  hour     = telegram->message_data[6];
-        uint8_t  min      = telegram->message_data[8];
+        telegram.read_value(codeNo, 2);
+        uint16_t year     = (telegram.message_data[4] & 0x7F) + 2000;
+        uint8_t  month    = telegram.message_data[5];
+        uint8_t  day      = telegram.message_data[7];
+        uint8_t  hour     = telegram.message_data[6];
+        uint8_t  min      = telegram.message_data[8];
         uint16_t duration = EMS_VALUE_INT16_NOTSET;
         uint32_t date     = (year - 2000) * 535680UL + month * 44640UL + day * 1440UL + hour * 60 + min;
-        telegram->read_value(duration, 9);
+        telegram.read_value(duration, 9);
         // store only the newest code from telegrams 12 and 13
         if (date > lastCodeDate_) {
             lastCodeDate_ = date;
@@ -1791,30 +1791,30 @@ void Thermostat::process_RCErrorMessage(std::shared_ptr<const Telegram> telegram
 }
 
 // 0xBF
-void Thermostat::process_ErrorMessageBF(std::shared_ptr<const Telegram> telegram) {
+void Thermostat::process_ErrorMessageBF(const Telegram & telegram) {
     EMSESP::send_read_request(0xC0, device_id(), 0, 20); // read last errorcode
 }
 
 // 0xC0 error log for RC300
-void Thermostat::process_RCErrorMessage2(std::shared_ptr<const Telegram> telegram) {
-    if (telegram->offset > 0 || telegram->message_length < 20) {
+void Thermostat::process_RCErrorMessage2(const Telegram & telegram) {
+    if (telegram.offset > 0 || telegram.message_length < 20) {
         return;
     }
-    uint8_t  code[4] = {telegram->message_data[5], telegram->message_data[6], telegram->message_data[7], 0};
-    uint16_t codeNo  = telegram->message_data[8] * 256 + telegram->message_data[9];
-    uint16_t year    = (telegram->message_data[10] & 0x7F) + 2000;
-    uint8_t  month   = telegram->message_data[11];
-    uint8_t  day     = telegram->message_data[13];
-    uint8_t  hour    = telegram->message_data[12];
-    uint8_t  min     = telegram->message_data[14];
-    uint16_t year1   = (telegram->message_data[15] & 0x7F) + 2000;
-    uint8_t  month1  = telegram->message_data[16];
-    uint8_t  day1    = telegram->message_data[18];
-    uint8_t  hour1   = telegram->message_data[17];
-    uint8_t  min1    = telegram->message_data[19];
+    uint8_t  code[4] = {telegram.message_data[5], telegram.message_data[6], telegram.message_data[7], 0};
+    uint16_t codeNo  = telegram.message_data[8] * 256 + telegram.message_data[9];
+    uint16_t year    = (telegram.message_data[10] & 0x7F) + 2000;
+    uint8_t  month   = telegram.message_data[11];
+    uint8_t  day     = telegram.message_data[13];
+    uint8_t  hour    = telegram.message_data[12];
+    uint8_t  min     = telegram.message_data[14];
+    uint16_t year1   = (telegram.message_data[15] & 0x7F) + 2000;
+    uint8_t  month1  = telegram.message_data[16];
+    uint8_t  day1    = telegram.message_data[18];
+    uint8_t  hour1   = telegram.message_data[17];
+    uint8_t  min1    = telegram.message_data[19];
     if (isprint(code[0]) && isprint(code[1]) && isprint(code[2])) {
         if (year == 2000) { // no clock
-            uint32_t min2 = 65536 * telegram->message_data[11] + 256 * telegram->message_data[12] + telegram->message_data[13];
+            uint32_t min2 = 65536 * telegram.message_data[11] + 256 * telegram.message_data[12] + telegram.message_data[13];
             snprintf(lastCode_, sizeof(lastCode_), "%s(%d) %d min", code, codeNo, min2);
         } else if (year1 == 2000) {
             snprintf(lastCode_, sizeof(lastCode_), "%s(%d) %02d.%02d.%d %02d:%02d", code, codeNo, day, month, year, hour, min);
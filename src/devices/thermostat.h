@@ -403,7 +403,7 @@ class Thermostat : public EMSdevice {
     static constexpr uint8_t EMS_TYPE_RC30wwSettings = 0x3A; // RC30 ww settings
     static constexpr uint8_t EMS_TYPE_time           = 0x06; // time
 
-    std::shared_ptr<Thermostat::HeatingCircuit> heating_circuit(std::shared_ptr<const Telegram> telegram);
+    std::shared_ptr<Thermostat::HeatingCircuit> heating_circuit(const Telegram & telegram);
     std::shared_ptr<Thermostat::HeatingCircuit> heating_circuit(const int8_t id);
     std::shared_ptr<Thermostat::DhwCircuit>     dhw_circuit(const uint8_t offset, const bool create = false);
 
@@ -412,66 +412,66 @@ class Thermostat : public EMSdevice {
 
     void add_ha_climate(std::shared_ptr<HeatingCircuit> hc) const;
 
-    void process_RCOutdoorTemp(std::shared_ptr<const Telegram> telegram);
-    void process_IBASettings(std::shared_ptr<const Telegram> telegram);
-    void process_RCTime(std::shared_ptr<const Telegram> telegram);
-    void process_RCError(std::shared_ptr<const Telegram> telegram);
-    void process_RCErrorMessage(std::shared_ptr<const Telegram> telegram);
-    void process_RCErrorMessage2(std::shared_ptr<const Telegram> telegram);
-    void process_ErrorMessageBF(std::shared_ptr<const Telegram> telegram);
-    void process_RC35wwSettings(std::shared_ptr<const Telegram> telegram);
-    void process_RC35wwTimer(std::shared_ptr<const Telegram> telegram);
-    void process_RC35Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC35Set(std::shared_ptr<const Telegram> telegram);
-    void process_RC35Timer(std::shared_ptr<const Telegram> telegram);
-    void process_RC30Vacation(std::shared_ptr<const Telegram> telegram);
-    void process_RC30Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC30Set(std::shared_ptr<const Telegram> telegram);
-    void process_RC30Temp(std::shared_ptr<const Telegram> telegram);
-    void process_RC30wwSettings(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Set(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Temp(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Timer(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Remote(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Monitor_2(std::shared_ptr<const Telegram> telegram);
-    void process_RC20Set_2(std::shared_ptr<const Telegram> telegram);
-    void process_RC10Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC10Set(std::shared_ptr<const Telegram> telegram);
-    void process_RC10Set_2(std::shared_ptr<const Telegram> telegram);
-    void process_CRFMonitor(std::shared_ptr<const Telegram> telegram);
-    void process_CR11Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Monitor(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Set(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Set2(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Summer(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Summer2(std::shared_ptr<const Telegram> telegram);
-    void process_RC300WWmode(std::shared_ptr<const Telegram> telegram);
-    void process_RC300WWmode2(std::shared_ptr<const Telegram> telegram);
-    void process_RC300WWtemp(std::shared_ptr<const Telegram> telegram);
-    void process_RC300OutdoorTemp(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Settings(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Floordry(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Holiday(std::shared_ptr<const Telegram> telegram);
-    void process_RC300Curve(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersMonitor(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersSet(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersSet2(std::shared_ptr<const Telegram> telegram);
-    void process_EasyMonitor(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersRemoteMonitor(std::shared_ptr<const Telegram> telegram);
-    void process_HybridSettings(std::shared_ptr<const Telegram> telegram);
-    void process_PVSettings(std::shared_ptr<const Telegram> telegram);
-    void process_Absent(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersSetMixer(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersWW(std::shared_ptr<const Telegram> telegram);
-    void process_JunkersDisp(std::shared_ptr<const Telegram> telegram);
-    void process_RemoteTemp(std::shared_ptr<const Telegram> telegram);
-    void process_RemoteHumidity(std::shared_ptr<const Telegram> telegram);
-    void process_RemoteCorrection(std::shared_ptr<const Telegram> telegram);
-    void process_RemoteBattery(std::shared_ptr<const Telegram> telegram);
-    void process_HPSet(std::shared_ptr<const Telegram> telegram);
-    void process_HPMode(std::shared_ptr<const Telegram> telegram);
-    void process_PID(std::shared_ptr<const Telegram> telegram);
+    void process_RCOutdoorTemp(const Telegram & telegram);
+    void process_IBASettings(const Telegram & telegram);
+    void process_RCTime(const Telegram & telegram);
+    void process_RCError(const Telegram & telegram);
+    void process_RCErrorMessage(const Telegram & telegram);
+    void process_RCErrorMessage2(const Telegram & telegram);
+    void process_ErrorMessageBF(const Telegram & telegram);
+    void process_RC35wwSettings(const Telegram & telegram);
+    void process_RC35wwTimer(const Telegram & telegram);
+    void process_RC35Monitor(const Telegram & telegram);
+    void process_RC35Set(const Telegram & telegram);
+    void process_RC35Timer(const Telegram & telegram);
+    void process_RC30Vacation(const Telegram & telegram);
+    void process_RC30Monitor(const Telegram & telegram);
+    void process_RC30Set(const Telegram & telegram);
+    void process_RC30Temp(const Telegram & telegram);
+    void process_RC30wwSettings(const Telegram & telegram);
+    void process_RC20Monitor(const Telegram & telegram);
+    void process_RC20Set(const Telegram & telegram);
+    void process_RC20Temp(const Telegram & telegram);
+    void process_RC20Timer(const Telegram & telegram);
+    void process_RC20Remote(const Telegram & telegram);
+    void process_RC20Monitor_2(const Telegram & telegram);
+    void process_RC20Set_2(const Telegram & telegram);
+    void process_RC10Monitor(const Telegram & telegram);
+    void process_RC10Set(const Telegram & telegram);
+    void process_RC10Set_2(const Telegram & telegram);
+    void process_CRFMonitor(const Telegram & telegram);
+    void process_CR11Monitor(const Telegram & telegram);
+    void process_RC300Monitor(const Telegram & telegram);
+    void process_RC300Set(const Telegram & telegram);
+    void process_RC300Set2(const Telegram & telegram);
+    void process_RC300Summer(const Telegram & telegram);
+    void process_RC300Summer2(const Telegram & telegram);
+    void process_RC300WWmode(const Telegram & telegram);
+    void process_RC300WWmode2(const Telegram & telegram);
+    void process_RC300WWtemp(const Telegram & telegram);
+    void process_RC300OutdoorTemp(const Telegram & telegram);
+    void process_RC300Settings(const Telegram & telegram);
+    void process_RC300Floordry(const Telegram & telegram);
+    void process_RC300Holiday(const Telegram & telegram);
+    void process_RC300Curve(const Telegram & telegram);
+    void process_JunkersMonitor(const Telegram & telegram);
+    void process_JunkersSet(const Telegram & telegram);
+    void process_JunkersSet2(const Telegram & telegram);
+    void process_EasyMonitor(const Telegram & telegram);
+    void process_JunkersRemoteMonitor(const Telegram & telegram);
+    void process_HybridSettings(const Telegram & telegram);
+    void process_PVSettings(const Telegram & telegram);
+    void process_Absent(const Telegram & telegram);
+    void process_JunkersSetMixer(const Telegram & telegram);
+    void process_JunkersWW(const Telegram & telegram);
+    void process_JunkersDisp(const Telegram & telegram);
+    void process_RemoteTemp(const Telegram & telegram);
+    void process_RemoteHumidity(const Telegram & telegram);
+    void process_RemoteCorrection(const Telegram & telegram);
+    void process_RemoteBattery(const Telegram & telegram);
+    void process_HPSet(const Telegram & telegram);
+    void process_HPMode(const Telegram & telegram);
+    void process_PID(const Telegram & telegram);
 
     // internal helper functions
     bool set_mode_n(const uint8_t mode, const int8_t id);
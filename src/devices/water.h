@@ -82,23 +82,23 @@ class Water : public EMSdevice {
     uint8_t  wwFlowTempOffset_; // default 40
 
 
-    void process_SM100wwTemperature(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwStatus(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwStatus2(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwCommand(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwCirc(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwParam(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwParam2(std::shared_ptr<const Telegram> telegram);
-    void process_SM100wwKeepWarm(std::shared_ptr<const Telegram> telegram);
-    void process_SM100ValveStatus(std::shared_ptr<const Telegram> telegram);
-
-    void process_MMPLUSStatusMessage_WWC(std::shared_ptr<const Telegram> telegram);
-    void process_MMPLUSSetMessage_WWC(std::shared_ptr<const Telegram> telegram);
-    void process_MMPLUSConfigMessage_WWC(std::shared_ptr<const Telegram> telegram);
-
-    void process_IPMMonitorWW(std::shared_ptr<const Telegram> telegram);
-    void process_IPMHydrTemp(std::shared_ptr<const Telegram> telegram);
-    void process_IPMParameterWW(std::shared_ptr<const Telegram> telegram);
+    void process_SM100wwTemperature(const Telegram & telegram);
+    void process_SM100wwStatus(const Telegram & telegram);
+    void process_SM100wwStatus2(const Telegram & telegram);
+    void process_SM100wwCommand(const Telegram & telegram);
+    void process_SM100wwCirc(const Telegram & telegram);
+    void process_SM100wwParam(const Telegram & telegram);
+    void process_SM100wwParam2(const Telegram & telegram);
+    void process_SM100wwKeepWarm(const Telegram & telegram);
+    void process_SM100ValveStatus(const Telegram & telegram);
+
+    void process_MMPLUSStatusMessage_WWC(const Telegram & telegram);
+    void process_MMPLUSSetMessage_WWC(const Telegram & telegram);
+    void process_MMPLUSConfigMessage_WWC(const Telegram & telegram);
+
+    void process_IPMMonitorWW(const Telegram & telegram);
+    void process_IPMHydrTemp(const Telegram & telegram);
+    void process_IPMParameterWW(const Telegram & telegram);
 
 
     bool set_wwSelTemp(const char * value, const int8_t id);
@@ -20,6 +20,11 @@
 
 #include "test.h"
 
+#ifdef EMSESP_STANDALONE
+#include <fstream>
+#include "HeapStats.h"
+#endif
+
 namespace emsesp {
 
 // no shell, called via the API or 'call system test' command
@@ -486,6 +491,16 @@ void Test::run_test(uuid::console::Shell & shell, const std::string & cmd, const
         ok = true;
     }
 
+    // e.g. "test replay capture.txt fast"
+    if (command == "replay") {
+        if (id1_s.empty()) {
+            shell.printfln("Usage: test replay <capture file> [fast]");
+            return;
+        }
+        replay(shell, id1_s, id2_s == "fast");
+        ok = true;
+    }
+
     if (command == "modes") {
         shell.printfln("Testing thermostat modes...");
         test("general");
@@ -2672,6 +2687,84 @@ void Test::uart_telegram(const char * rx_data) {
     refresh();
 }
 
+#ifdef EMSESP_STANDALONE
+// feeds a bus capture (see BusCapture) to the UART handler at the recorded speed or as fast as possible,
+// decoding after each frame like the main loop, and reports the throughput, the time of each stage and the allocations
+void Test::replay(uuid::console::Shell & shell, const std::string & filename, const bool fast) {
+    std::ifstream file(filename);
+    if (!file) {
+        shell.printfln("Can't open capture file %s", filename.c_str());
+        return;
+    }
+
+    // only the results, no log or watch for every telegram
+    auto log_level = shell.log_level();
+    auto watch     = EMSESP::watch();
+    shell.log_level(uuid::log::Level::NOTICE);
+    EMSESP::watch(EMSESP::Watch::WATCH_OFF);
+
+    static constexpr uint32_t REPLAY_TIMING_US[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 5000};
+    Histogram                 uart_time(REPLAY_TIMING_US);
+    Histogram                 decode_time(REPLAY_TIMING_US);
+    EMSbus::poll_to_send_.reset();
+    EMSbus::tx_to_reply_.reset();
+    EMSbus::rx_queue_time_.reset();
+
+    uint32_t telegrams      = EMSESP::rxservice_.telegram_count();
+    uint32_t errors         = EMSESP::rxservice_.telegram_error_count();
+    uint32_t allocs         = heap_alloc_count();
+    uint32_t pool_fallbacks = TelegramPool::fallback_count();
+    uint32_t frames         = 0;
+
+    std::string line;
+    uint8_t     data[EMS_MAX_TELEGRAM_LENGTH];
+    uint32_t    delta_us;
+    auto        start = std::chrono::steady_clock::now();
+    auto        due   = start;
+    while (std::getline(file, line)) {
+        uint8_t length = BusCapture::parse(line.c_str(), delta_us, data);
+        if (!length) {
+            continue;
+        }
+        if (!fast) {
+            due += std::chrono::microseconds(delta_us);
+            std::this_thread::sleep_until(due);
+        }
+
+        uuid::loop();
+        uint32_t t0 = ::micros();
+        EMSESP::incoming_telegram(data, length);
+        uint32_t t1 = ::micros();
+        EMSESP::rxservice_.loop();
+        uart_time.add(t1 - t0);
+        decode_time.add(::micros() - t1);
+        frames++;
+    }
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    allocs         = heap_alloc_count() - allocs;
+    pool_fallbacks = TelegramPool::fallback_count() - pool_fallbacks;
+    telegrams      = EMSESP::rxservice_.telegram_count() - telegrams;
+    errors         = EMSESP::rxservice_.telegram_error_count() - errors;
+
+    shell.log_level(log_level);
+    EMSESP::watch(watch);
+
+    auto show_timing = [&](const char * name, const Histogram & histogram) {
+        shell.printfln("    %s: %d/%d/%d us", name, histogram.percentile(50), histogram.percentile(95), histogram.max());
+    };
+    shell.printfln("Replayed %s%s: %d frames, %d telegrams, %d incomplete", filename.c_str(), fast ? " (fast)" : "", frames, telegrams, errors);
+    shell.printfln("  Time: %d ms, %d frames/s", (uint32_t)(elapsed_us / 1000), elapsed_us ? (uint32_t)(frames * 1000000ULL / elapsed_us) : 0);
+    shell.printfln("  Time per stage (p50/p95/max):");
+    show_timing("UART handler", uart_time);
+    show_timing("Rx queue", EMSbus::rx_queue_time_);
+    show_timing("Decode", decode_time);
+    show_timing("Poll to send", EMSbus::poll_to_send_);
+    show_timing("Tx to reply", EMSbus::tx_to_reply_);
+    shell.printfln("  Allocations: %d (%d per 100 frames), %d telegrams from the heap", allocs, frames ? allocs * 100 / frames : 0, pool_fallbacks);
+}
+#endif
+
 void Test::add_device(uint8_t device_id, uint8_t product_id) {
     uart_telegram({device_id, EMSESP_DEFAULT_EMS_BUS_ID, EMSdevice::EMS_TYPE_VERSION, 0, product_id, 1, 0});
 }
@@ -81,6 +81,9 @@ class Test {
     static void add_device(uint8_t device_id, uint8_t product_id);
     static void refresh();
     static void listDir(fs::FS & fs, const char * dirname, uint8_t levels);
+#ifdef EMSESP_STANDALONE
+    static void replay(uuid::console::Shell & shell, const std::string & filename, const bool fast);
+#endif
 };
 
 } // namespace emsesp
@@ -107,20 +107,31 @@ void WebAPIService::parse(AsyncWebServerRequest * request, JsonObject input) {
     // capture current heap memory before allocating the large return buffer
     EMSESP::system_.refreshHeapMem();
 
-    // output json buffer
-    auto response = new AsyncJsonResponse();
-
-    // add more mem if needed - won't be needed in ArduinoJson 7
-    // while (!response->getSize()) {
-    //     delete response;
-    //     buffer -= 1024;
-    //     response = new AsyncJsonResponse(false, buffer);
-    // }
+    // called in the main loop, e.g. from the unit tests
+    if (Command::in_loop()) {
+        JsonDocument output_doc;
+        JsonObject   output = output_doc.to<JsonObject>();
+        send_response(request, Command::process(request->url().c_str(), is_admin, input, output), output);
+        return;
+    }
 
-    JsonObject output = response->getRoot();
+    // the command runs in the main loop, which sends the response when it is done
+    // the AsyncTCP task is free in the meantime, if the client is gone the response is dropped
+    AsyncWebServerRequestPtr request_ptr = request->pause();
+    if (!Command::post(request->url().c_str(), is_admin, input, [this, request_ptr](const uint8_t return_code, JsonObject output) {
+            if (auto request = request_ptr.lock()) {
+                send_response(request.get(), return_code, output);
+            }
+        })) {
+        JsonDocument output_doc;
+        JsonObject   output = output_doc.to<JsonObject>();
+        output["message"]   = "command queue full";
+        send_response(request, CommandRet::ERROR, output);
+    }
+}
 
-    // call command
-    uint8_t return_code = Command::process(request->url().c_str(), is_admin, input, output);
+// send the output of a command, as text if it's a single value
+void WebAPIService::send_response(AsyncWebServerRequest * request, const uint8_t return_code, JsonObject output) {
     if (return_code != CommandRet::OK) {
         api_fails_++;
     }
@@ -140,7 +151,6 @@ void WebAPIService::parse(AsyncWebServerRequest * request, JsonObject input) {
         Serial.println(COLOR_RESET);
 #endif
         api_count_++;
-        delete response;
         return;
     }
 
@@ -155,6 +165,8 @@ void WebAPIService::parse(AsyncWebServerRequest * request, JsonObject input) {
     // 400 (invalid)
     int ret_codes[7] = {400, 200, 404, 400, 401, 400, 404};
 
+    auto response = new AsyncJsonResponse();
+    response->getRoot().set(output);
     response->setCode(ret_codes[return_code]);
     response->setLength();
     response->setContentType("application/json; charset=utf-8");
@@ -52,6 +52,7 @@ class WebAPIService {
     static uint16_t api_fails_;
 
     void parse(AsyncWebServerRequest * request, JsonObject input);
+    void send_response(AsyncWebServerRequest * request, const uint8_t return_code, JsonObject output);
 };
 
 } // namespace emsesp
@@ -80,6 +80,7 @@ StateUpdateResult WebCustomEntity::update(JsonObject root, WebCustomEntity & web
     }
     webCustomEntity.customEntityItems.clear();
     EMSESP::webCustomEntityService.ha_reset();
+    EMSESP::entity_bindings_changed();
 
     // rebuild the list
     if (root["entities"].is<JsonArray>()) {
@@ -105,9 +106,10 @@ StateUpdateResult WebCustomEntity::update(JsonObject root, WebCustomEntity & web
             }
             entityItem.raw = nullptr;
             if (entityItem.ram == 0 && entityItem.value_type == DeviceValueType::STRING) {
-                entityItem.raw  = new uint8_t[(size_t)entityItem.factor + 1];
-                entityItem.data = "";
-                entityItem.uom  = 0;
+                entityItem.raw         = new uint8_t[(size_t)entityItem.factor + 1];
+                entityItem.raw_changed = true;
+                entityItem.data        = "";
+                entityItem.uom         = 0;
             } else if (entityItem.value_type == DeviceValueType::BOOL) {
                 entityItem.value = EMS_VALUE_DEFAULT_BOOL;
                 entityItem.uom   = 0;
@@ -142,12 +144,11 @@ StateUpdateResult WebCustomEntity::update(JsonObject root, WebCustomEntity & web
             }
 
             if (entityItem.ram && doc[entityItem.name].is<JsonVariantConst>() && doc[entityItem.name] != entityItem.value) {
-                char cmd[COMMAND_MAX_LENGTH];
-                snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), entityItem.name);
-                EMSESP::webSchedulerService.onChange(cmd);
+                EMSESP::webCustomEntityService.notify_scheduler(entityItem);
             }
         }
     }
+    EMSESP::webCustomEntityService.build_index(webCustomEntity.customEntityItems);
     return StateUpdateResult::CHANGED;
 }
 
@@ -212,9 +213,7 @@ bool WebCustomEntityService::command_setvalue(const char * value, const int8_t i
             if (EMSESP::mqtt_.get_publish_onchange(0)) {
                 publish();
             }
-            char cmd[COMMAND_MAX_LENGTH];
-            snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), entityItem.name);
-            EMSESP::webSchedulerService.onChange(cmd);
+            notify_scheduler(entityItem);
             return true;
         }
     }
@@ -227,55 +226,78 @@ void WebCustomEntityService::render_value(JsonObject output, CustomEntityItem co
     char         payload[20];
     const char * name = useVal ? "value" : (const char *)entity.name;
 
+    if (value_text(entity, payload, web) == nullptr) {
+        return;
+    }
+
     switch (entity.value_type) {
     case DeviceValueType::BOOL:
-        if ((uint8_t)entity.value != EMS_VALUE_BOOL_NOTSET) {
-            if (web) {
-                output[name] = Helpers::render_boolean(payload, (uint8_t)entity.value, true);
-            } else {
-                Mqtt::add_value_bool(output, name, (uint8_t)entity.value != 0);
-            }
+        if (web) {
+            output[name] = payload;
+        } else {
+            Mqtt::add_value_bool(output, name, (uint8_t)entity.value != 0);
         }
         break;
     case DeviceValueType::INT8:
-        if ((int8_t)entity.value != EMS_VALUE_INT8_NOTSET) {
-            std::string v = Helpers::render_value(payload, entity.factor * (int8_t)entity.value, 2);
-            output[name]  = add_uom ? serialized(v + ' ' + EMSdevice::uom_to_string(entity.uom)) : serialized(v);
+    case DeviceValueType::UINT8:
+    case DeviceValueType::INT16:
+    case DeviceValueType::UINT16:
+    case DeviceValueType::UINT24:
+    case DeviceValueType::TIME:
+    case DeviceValueType::UINT32:
+        if (add_uom) {
+            output[name] = serialized(std::string(payload) + ' ' + EMSdevice::uom_to_string(entity.uom));
+        } else {
+            output[name] = serialized(payload);
         }
         break;
+    // case DeviceValueType::STRING:
+    default:
+        output[name] = add_uom ? entity.data + ' ' + EMSdevice::uom_to_string(entity.uom) : entity.data;
+        break;
+    }
+}
+
+// render the value of an entity as text into payload (20 chars), strings point to the entity data
+// numbers are plain json numbers, returns nullptr if the entity has no value
+const char * WebCustomEntityService::value_text(CustomEntityItem const & entity, char * payload, const bool web) {
+    switch (entity.value_type) {
+    case DeviceValueType::BOOL:
+        if ((uint8_t)entity.value == EMS_VALUE_BOOL_NOTSET) {
+            return nullptr;
+        }
+        return Helpers::render_boolean(payload, (uint8_t)entity.value != 0, web);
+    case DeviceValueType::INT8:
+        if ((int8_t)entity.value == EMS_VALUE_INT8_NOTSET) {
+            return nullptr;
+        }
+        return Helpers::render_value(payload, entity.factor * (int8_t)entity.value, 2);
     case DeviceValueType::UINT8:
-        if ((uint8_t)entity.value != EMS_VALUE_UINT8_NOTSET) {
-            std::string v = Helpers::render_value(payload, entity.factor * (int8_t)entity.value, 2);
-            output[name]  = add_uom ? serialized(v + ' ' + EMSdevice::uom_to_string(entity.uom)) : serialized(v);
+        if ((uint8_t)entity.value == EMS_VALUE_UINT8_NOTSET) {
+            return nullptr;
         }
-        break;
+        return Helpers::render_value(payload, entity.factor * (int8_t)entity.value, 2);
     case DeviceValueType::INT16:
-        if ((int16_t)entity.value != EMS_VALUE_INT16_NOTSET) {
-            std::string v = Helpers::render_value(payload, entity.factor * (int16_t)entity.value, 2);
-            output[name]  = add_uom ? serialized(v + ' ' + EMSdevice::uom_to_string(entity.uom)) : serialized(v);
+        if ((int16_t)entity.value == EMS_VALUE_INT16_NOTSET) {
+            return nullptr;
         }
-        break;
+        return Helpers::render_value(payload, entity.factor * (int16_t)entity.value, 2);
     case DeviceValueType::UINT16:
-        if ((uint16_t)entity.value != EMS_VALUE_UINT16_NOTSET) {
-            std::string v = Helpers::render_value(payload, entity.factor * (uint16_t)entity.value, 2);
-            output[name]  = add_uom ? serialized(v + ' ' + EMSdevice::uom_to_string(entity.uom)) : serialized(v);
+        if ((uint16_t)entity.value == EMS_VALUE_UINT16_NOTSET) {
+            return nullptr;
         }
-        break;
+        return Helpers::render_value(payload, entity.factor * (uint16_t)entity.value, 2);
     case DeviceValueType::UINT24:
     case DeviceValueType::TIME:
     case DeviceValueType::UINT32:
-        if (entity.value != EMS_VALUE_UINT24_NOTSET) {
-            std::string v = Helpers::render_value(payload, entity.factor * entity.value, 2);
-            output[name]  = add_uom ? serialized(v + ' ' + EMSdevice::uom_to_string(entity.uom)) : serialized(v);
+        if (entity.value == EMS_VALUE_UINT24_NOTSET) {
+            return nullptr;
         }
-        break;
+        return Helpers::render_value(payload, entity.factor * entity.value, 2);
     // case DeviceValueType::STRING:
     default:
         // if no type treat it as a string
-        if (entity.data.length() > 0) {
-            output[name] = add_uom ? entity.data + ' ' + EMSdevice::uom_to_string(entity.uom) : entity.data;
-        }
-        break;
+        return entity.data.length() > 0 ? entity.data.c_str() : nullptr;
     }
 }
 
@@ -331,6 +353,36 @@ bool WebCustomEntityService::get_value_info(JsonObject output, const char * cmd)
     return false; // not found
 }
 
+// report a changed value to the scheduler
+void WebCustomEntityService::notify_scheduler(CustomEntityItem const & entity) {
+    if (EMSESP::webSchedulerService.watches(EMSdevice::DeviceType::CUSTOM)) {
+        char cmd[COMMAND_MAX_LENGTH];
+        snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), entity.name);
+        EMSESP::webSchedulerService.onChange(cmd);
+    }
+}
+
+// find an entity by name (ignoring case), nullptr if not found
+CustomEntityItem * WebCustomEntityService::find_entity(const char * name) {
+    for (auto & entity : *customEntityItems_) {
+        if (strcasecmp(entity.name, name) == 0) {
+            return &entity;
+        }
+    }
+    return nullptr;
+}
+
+// the "value" attribute of an entity as get_value_json() renders it, returns false if it has no value
+bool WebCustomEntityService::get_value_string(CustomEntityItem const & entity, std::string & value) {
+    char         payload[20];
+    const char * text = value_text(entity, payload);
+    if (text == nullptr) {
+        return false;
+    }
+    value = text;
+    return true;
+}
+
 // build the json for specific entity
 void WebCustomEntityService::get_value_json(JsonObject output, CustomEntityItem const & entity) {
     output["name"]      = (const char *)entity.name;
@@ -595,9 +647,17 @@ void WebCustomEntityService::generate_value_web(JsonObject output, const bool is
 }
 
 // fetch telegram, called from emsesp::fetch
+// entities in the same telegram are read together, with as few reads as fit in a telegram
 void WebCustomEntityService::fetch() {
     const uint8_t len[] = {1, 1, 1, 2, 2, 3, 3, 4};
 
+    struct ReadRequest {
+        uint32_t key_; // telegram_key()
+        uint8_t  offset_;
+        uint8_t  length_;
+    };
+    std::vector<ReadRequest> reads;
+
     for (auto const & entity : *customEntityItems_) {
         if (entity.device_id > 0 && entity.type_id > 0) { // this excludes also RAM type
             bool    needFetch  = true;
@@ -613,53 +673,86 @@ void WebCustomEntityService::fetch() {
                 }
             }
             if (needFetch) {
-                EMSESP::send_read_request(entity.type_id,
-                                          entity.device_id,
-                                          entity.offset,
-                                          entity.value_type == DeviceValueType::STRING ? (uint8_t)entity.factor : len[entity.value_type]);
+                reads.push_back({telegram_key(entity.device_id, entity.type_id),
+                                 entity.offset,
+                                 entity.value_type == DeviceValueType::STRING ? (uint8_t)entity.factor : len[entity.value_type]});
             }
         }
     }
+
+    std::sort(reads.begin(), reads.end(), [](const ReadRequest & a, const ReadRequest & b) {
+        return a.key_ < b.key_ || (a.key_ == b.key_ && a.offset_ < b.offset_);
+    });
+
+    // merge reads of the same telegram as long as the answer fits in one telegram
+    for (size_t i = 0; i < reads.size();) {
+        uint32_t key     = reads[i].key_;
+        uint16_t type_id = key & 0xFFFF;
+        uint8_t  max_len = type_id > 0x0FF ? EMS_MAX_TELEGRAM_MESSAGE_LENGTH - 2 : EMS_MAX_TELEGRAM_MESSAGE_LENGTH; // EMS+ header is 2 bytes longer
+        uint8_t  offset  = reads[i].offset_;
+        uint16_t end     = offset + reads[i].length_;
+        for (i++; i < reads.size() && reads[i].key_ == key; i++) {
+            uint16_t next_end = std::max(end, (uint16_t)(reads[i].offset_ + reads[i].length_));
+            if (next_end - offset > max_len) {
+                break;
+            }
+            end = next_end;
+        }
+        EMSESP::send_read_request(type_id, key >> 16, offset, end - offset);
+    }
+}
+
+// index the entities read from telegrams by device and type
+void WebCustomEntityService::build_index(std::list<CustomEntityItem, AllocatorPSRAM<CustomEntityItem>> & customEntityItems) {
+    telegram_index_.clear();
+    for (CustomEntityItem & entity : customEntityItems) {
+        if (entity.ram == 0) {
+            telegram_index_.push_back({telegram_key(entity.device_id, entity.type_id), &entity});
+        }
+    }
+    std::stable_sort(telegram_index_.begin(), telegram_index_.end(), [](const TelegramIndex & a, const TelegramIndex & b) { return a.key_ < b.key_; });
 }
 
 // called on process telegram, read from telegram
-bool WebCustomEntityService::get_value(std::shared_ptr<const Telegram> telegram) {
+bool WebCustomEntityService::get_value(const Telegram & telegram) {
     bool has_change = false;
     // read-length of BOOL, INT8, UINT8, INT16, UINT16, UINT24, TIME, UINT32
     const uint8_t len[] = {1, 1, 1, 2, 2, 3, 3, 4};
-    for (auto & entity : *customEntityItems_) {
-        if (entity.value_type == DeviceValueType::STRING && entity.raw && telegram->type_id == entity.type_id && telegram->src == entity.device_id
-            && (telegram->offset >= entity.offset || entity.offset < telegram->offset + telegram->message_length)) {
-            auto message_length = telegram->message_length;
-            auto message_data   = telegram->message_data;
-            auto offset         = telegram->offset - entity.offset;
-            if (telegram->offset < entity.offset) {
-                message_data = &telegram->message_data[entity.offset - telegram->offset];
-                message_length -= entity.offset - telegram->offset;
+    uint32_t      key   = telegram_key(telegram.src, telegram.type_id);
+
+    auto it = std::lower_bound(telegram_index_.begin(), telegram_index_.end(), key, [](const TelegramIndex & t, const uint32_t k) { return t.key_ < k; });
+    for (; it != telegram_index_.end() && it->key_ == key; ++it) {
+        CustomEntityItem & entity = *it->item_;
+        if (entity.value_type == DeviceValueType::STRING && entity.raw
+            && (telegram.offset >= entity.offset || entity.offset < telegram.offset + telegram.message_length)) {
+            auto message_length = telegram.message_length;
+            auto message_data   = telegram.message_data;
+            auto offset         = telegram.offset - entity.offset;
+            if (telegram.offset < entity.offset) {
+                message_data = &telegram.message_data[entity.offset - telegram.offset];
+                message_length -= entity.offset - telegram.offset;
                 offset = 0;
             }
             auto length = std::min(offset + message_length, (int)entity.factor);
             auto rest   = std::min((int)entity.factor - offset, (int)message_length);
             if (rest > 0) {
+                entity.raw_changed |= memcmp(&entity.raw[offset], message_data, rest) != 0;
                 memcpy(&entity.raw[offset], message_data, rest);
-                auto data = Helpers::data_to_hex(entity.raw, (uint8_t)length);
-                if (entity.data != data.c_str() && length == (int)entity.factor) {
-                    entity.data = data.c_str();
+                if (entity.raw_changed && length == (int)entity.factor) {
+                    entity.raw_changed = false;
+                    entity.data        = Helpers::data_to_hex(entity.raw, (uint8_t)length).c_str();
                     if (Mqtt::publish_single()) {
                         publish_single(entity);
                     } else if (EMSESP::mqtt_.get_publish_onchange(0)) {
                         has_change = true;
                     }
-                    char cmd[COMMAND_MAX_LENGTH];
-                    snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), entity.name);
-                    EMSESP::webSchedulerService.onChange(cmd);
+                    notify_scheduler(entity);
                 }
             }
-        } else if (entity.value_type != DeviceValueType::STRING && telegram->type_id == entity.type_id && telegram->src == entity.device_id
-                   && telegram->offset <= entity.offset && (telegram->offset + telegram->message_length) >= (entity.offset + len[entity.value_type])) {
+        } else if (entity.value_type != DeviceValueType::STRING && telegram.offset <= entity.offset && (telegram.offset + telegram.message_length) >= (entity.offset + len[entity.value_type])) {
             uint32_t value = 0;
             for (uint8_t i = 0; i < len[entity.value_type]; i++) {
-                value = (value << 8) + telegram->message_data[i + entity.offset - telegram->offset];
+                value = (value << 8) + telegram.message_data[i + entity.offset - telegram.offset];
             }
             // mask bits for bool values
             if (entity.value_type == DeviceValueType::BOOL && entity.factor > 0) {
@@ -672,9 +765,7 @@ bool WebCustomEntityService::get_value(std::shared_ptr<const Telegram> telegram)
                 } else if (EMSESP::mqtt_.get_publish_onchange(0)) {
                     has_change = true;
                 }
-                char cmd[COMMAND_MAX_LENGTH];
-                snprintf(cmd, sizeof(cmd), "%s/%s", F_(custom), entity.name);
-                EMSESP::webSchedulerService.onChange(cmd);
+                notify_scheduler(entity);
             }
             // EMSESP::logger().debug("custom entity %s received with value %d", entity.name, (int)entity.val);
         }
@@ -694,6 +785,7 @@ bool WebCustomEntityService::get_value(std::shared_ptr<const Telegram> telegram)
 void WebCustomEntityService::load_test_data() {
     update([&](WebCustomEntity & webCustomEntity) {
         webCustomEntity.customEntityItems.clear(); // delete all existing entities
+        EMSESP::entity_bindings_changed();
 
         auto entityItem = CustomEntityItem();
 
@@ -779,6 +871,7 @@ void WebCustomEntityService::load_test_data() {
             FL_(entity_cmd),
             CommandFlag::ADMIN_ONLY);
 
+        build_index(webCustomEntity.customEntityItems);
         return StateUpdateResult::CHANGED; // persist the changes
     });
 }
@@ -41,6 +41,7 @@ class CustomEntityItem {
     stringPSRAM data;
     uint8_t     ram;
     uint8_t *   raw;
+    bool        raw_changed; // raw differs from data, set again when the last part is received
     bool        hide;
 };
 
@@ -62,12 +63,17 @@ class WebCustomEntityService : public StatefulService<WebCustomEntity> {
     bool command_setvalue(const char * value, const int8_t id, const char * name);
     bool get_value_info(JsonObject output, const char * cmd);
     void get_value_json(JsonObject output, CustomEntityItem const & entity);
-    bool get_value(std::shared_ptr<const Telegram> telegram);
+    bool get_value_string(CustomEntityItem const & entity, std::string & value);
+    void notify_scheduler(CustomEntityItem const & entity);
+    bool get_value(const Telegram & telegram);
+    void build_index(std::list<CustomEntityItem, AllocatorPSRAM<CustomEntityItem>> & customEntityItems);
     void fetch();
     void render_value(JsonObject output, CustomEntityItem const & entity, const bool useVal = false, const bool web = false, const bool add_uom = false);
     void show_values(JsonObject output);
     void generate_value_web(JsonObject output, const bool is_dashboard = false);
 
+    CustomEntityItem * find_entity(const char * name);
+
     uint8_t count_entities();
     void    ha_reset() {
         ha_configdone_ = false;
@@ -81,10 +87,22 @@ class WebCustomEntityService : public StatefulService<WebCustomEntity> {
     HttpEndpoint<WebCustomEntity>  _httpEndpoint;
     FSPersistence<WebCustomEntity> _fsPersistence;
 
-    void getEntities(AsyncWebServerRequest * request);
+    void         getEntities(AsyncWebServerRequest * request);
+    const char * value_text(CustomEntityItem const & entity, char * payload, const bool web = false);
 
     std::list<CustomEntityItem, AllocatorPSRAM<CustomEntityItem>> * customEntityItems_; // pointer to the list of entity items
 
+    // the entities read from a telegram, by telegram_key()
+    struct TelegramIndex {
+        uint32_t           key_;
+        CustomEntityItem * item_;
+    };
+    std::vector<TelegramIndex, AllocatorPSRAM<TelegramIndex>> telegram_index_; // sorted by key, in list order for the same key
+
+    static uint32_t telegram_key(const uint8_t device_id, const uint16_t type_id) {
+        return ((uint32_t)device_id << 16) | type_id;
+    }
+
     bool ha_configdone_ = false;
 };
 
@@ -42,10 +42,10 @@ void WebSchedulerService::begin() {
 #ifndef EMSESP_STANDALONE
     if (EMSESP::system_.PSram()) {
 #if defined(CONFIG_FREERTOS_UNICORE) || (EMSESP_SCHEDULER_RUNNING_CORE < 0)
-        xTaskCreate((TaskFunction_t)scheduler_task, "scheduler_task", EMSESP_SCHEDULER_STACKSIZE, NULL, EMSESP_SCHEDULER_PRIORITY, NULL);
+        xTaskCreate((TaskFunction_t)scheduler_task, "scheduler_task", EMSESP_SCHEDULER_STACKSIZE, NULL, EMSESP_SCHEDULER_PRIORITY, &task_handle_);
 #else
         xTaskCreatePinnedToCore(
-            (TaskFunction_t)scheduler_task, "scheduler_task", EMSESP_SCHEDULER_STACKSIZE, NULL, EMSESP_SCHEDULER_PRIORITY, NULL, EMSESP_SCHEDULER_RUNNING_CORE);
+            (TaskFunction_t)scheduler_task, "scheduler_task", EMSESP_SCHEDULER_STACKSIZE, NULL, EMSESP_SCHEDULER_PRIORITY, &task_handle_, EMSESP_SCHEDULER_RUNNING_CORE);
 #endif
     }
 #endif
@@ -93,6 +93,12 @@ StateUpdateResult WebScheduler::update(JsonObject root, WebScheduler & webSchedu
         si.elapsed_min = Helpers::string2minutes(si.time.c_str());
         si.retry_cnt   = 0xFF; // no startup retries
 
+        // compile the expressions once, they are evaluated on every check
+        if (si.flags == SCHEDULEFLAG_SCHEDULE_CONDITION) {
+            si.time_expr.compile(si.time.c_str());
+        }
+        si.value_expr.compile(si.value.c_str());
+
         webScheduler.scheduleItems.push_back(si); // add to list
         if (webScheduler.scheduleItems.back().name[0] != '\0') {
             Command::add(
@@ -105,6 +111,7 @@ StateUpdateResult WebScheduler::update(JsonObject root, WebScheduler & webSchedu
                 CommandFlag::ADMIN_ONLY);
         }
     }
+    EMSESP::webSchedulerService.build_index(webScheduler.scheduleItems);
     return StateUpdateResult::CHANGED;
 }
 
@@ -124,6 +131,12 @@ bool WebSchedulerService::command_setvalue(const char * value, const int8_t id,
             scheduleItem.active = v;
             publish_single(name, v);
 
+            // immediate schedules run once when activated
+            if (v && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_IMMEDIATE) {
+                cmd_changed_.push_back(&scheduleItem);
+                wake();
+            }
+
             if (EMSESP::mqtt_.get_publish_onchange(0)) {
                 publish();
             }
@@ -370,7 +383,7 @@ bool WebSchedulerService::command(const char * name, const std::string & command
     char command_str[COMMAND_MAX_LENGTH];
     snprintf(command_str, sizeof(command_str), "/api/%s", cmd.c_str());
 
-    uint8_t return_code = Command::process(command_str, true, input, output); // admin set
+    uint8_t return_code = Command::execute(command_str, true, input, output); // admin set
     if (return_code == CommandRet::OK) {
 #if defined(EMSESP_DEBUG)
         EMSESP::logger().debug("Schedule command '%s' with data '%s' was successful", cmd.c_str(), data.c_str());
@@ -393,29 +406,168 @@ bool WebSchedulerService::command(const char * name, const std::string & command
     return false;
 }
 
-// called from emsesp.cpp on every entity-change
-// queue schedules to be handled executed in scheduler-loop
+// index the schedules, so the loop only touches the ones that are due:
+// - onChange schedules by the entities in their time field, like "boiler/outdoortemp thermostat/hc1/seltemp"
+//   and the device types onChange() has to be called for, also those read by conditions
+// - timers with an interval by the minute they are due, and those to run at startup
+// - weekly schedules by day and minute
+// - active immediate schedules are queued to run
+void WebSchedulerService::build_index(std::list<ScheduleItem, AllocatorPSRAM<ScheduleItem>> & scheduleItems) {
+    static const char * path_chars = "/._abcdefghijklmnopqrstuvwxyz0123456789";
+
+    cmd_changed_.clear(); // points to the old list
+    onchange_index_.clear();
+    timers_.clear();
+    startup_.clear();
+    for (auto & day : calendar_) {
+        day.clear();
+    }
+    uint32_t watched    = 0;
+    uint16_t order      = 0;
+    uint32_t uptime_min = uuid::get_uptime_sec() / 60;
+
+    for (ScheduleItem & scheduleItem : scheduleItems) {
+        order++;
+        if (scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_IMMEDIATE) {
+            if (scheduleItem.active) {
+                cmd_changed_.push_back(&scheduleItem);
+            }
+            continue;
+        }
+        if (scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_TIMER) {
+            if (scheduleItem.elapsed_min == 0) {
+                startup_.push_back(&scheduleItem);
+            } else {
+                timers_.push_back({(uptime_min / scheduleItem.elapsed_min + 1) * scheduleItem.elapsed_min, order, &scheduleItem});
+                std::push_heap(timers_.begin(), timers_.end(), timer_later);
+            }
+            continue;
+        }
+        if (!(scheduleItem.flags & SCHEDULEFLAG_SCHEDULE_TIMER)) {
+            for (uint8_t day = 0; day < 7; day++) {
+                if (scheduleItem.flags & (1 << day)) {
+                    calendar_[day].push_back({scheduleItem.elapsed_min, &scheduleItem});
+                }
+            }
+            continue;
+        }
+        if (scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_CONDITION) {
+            watched |= scheduleItem.time_expr.device_types();
+            continue;
+        }
+        if (scheduleItem.flags != SCHEDULEFLAG_SCHEDULE_ONCHANGE) {
+            continue;
+        }
+        auto   time = Helpers::toLower(scheduleItem.time.c_str());
+        size_t f    = time.find_first_of(path_chars);
+        while (f != std::string::npos) {
+            size_t e    = time.find_first_not_of(path_chars, f);
+            auto   path = time.substr(f, e == std::string::npos ? std::string::npos : e - f);
+            f           = e == std::string::npos ? e : time.find_first_of(path_chars, e);
+            auto slash  = path.find('/');
+            if (slash == std::string::npos) {
+                continue;
+            }
+            if (path.length() > 6 && path.compare(path.length() - 6, 6, "/value") == 0) {
+                path.resize(path.length() - 6);
+            }
+            bool dup = false;
+            for (const auto & o : onchange_index_) {
+                dup |= o.item_ == &scheduleItem && o.path_ == path;
+            }
+            if (!dup) {
+                watched |= (uint32_t)1 << EMSdevice::device_name_2_device_type(path.substr(0, slash).c_str());
+                onchange_index_.push_back({Helpers::hash_lower(path.c_str()), path, &scheduleItem});
+            }
+        }
+    }
+
+    std::stable_sort(onchange_index_.begin(), onchange_index_.end(), [](const OnChangeIndex & a, const OnChangeIndex & b) { return a.hash_ < b.hash_; });
+    for (auto & day : calendar_) {
+        std::stable_sort(day.begin(), day.end(), [](const CalendarEntry & a, const CalendarEntry & b) { return a.minute_ < b.minute_; });
+    }
+    watched_devices_.store(watched, std::memory_order_relaxed);
+    wake();
+}
+
+// wake the scheduler task before its next deadline, for changes and commands
+void WebSchedulerService::wake() {
+#ifndef EMSESP_STANDALONE
+    if (task_handle_) {
+        xTaskNotifyGive(task_handle_);
+    }
+#endif
+}
+
+// queue a system/message for this task, false if the queue is full
+bool WebSchedulerService::message(const char * value) {
+    if (!messages_.push(std::string(value))) {
+        return false;
+    }
+    wake();
+    return true;
+}
+
+// time until the next condition poll and uptime minute (every 10 seconds of uptime) or the next minute of the clock
+uint32_t WebSchedulerService::next_deadline_ms() const {
+    uint32_t uptime_ms = 10000 - uuid::get_uptime_ms() % 10000;
+    uint32_t clock_ms  = (60 - time(nullptr) % 60) * 1000;
+    return std::min(uptime_ms, clock_ms);
+}
+
+// called from emsesp.cpp on every entity-change, check watches() first
+// mark the entity for the conditions reading it, and queue all onChange schedules for it to be executed in scheduler-loop
 bool WebSchedulerService::onChange(const char * cmd) {
-    for (ScheduleItem & scheduleItem : *scheduleItems_) {
-        if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_ONCHANGE
-            && Helpers::toLower(scheduleItem.time.c_str()).find(Helpers::toLower(cmd)) != std::string::npos) {
-            cmd_changed_.push_back(&scheduleItem);
-            return true;
+    uint32_t hash = Helpers::hash_lower(cmd);
+    changed_entities_[(hash >> 5) % CHANGED_WORDS].fetch_or((uint32_t)1 << (hash & 31), std::memory_order_relaxed);
+
+    bool queued = false;
+    auto it     = std::lower_bound(onchange_index_.begin(), onchange_index_.end(), hash, [](const OnChangeIndex & o, const uint32_t h) { return o.hash_ < h; });
+    for (; it != onchange_index_.end() && it->hash_ == hash; ++it) {
+        if (it->item_->active && strcasecmp(it->path_.c_str(), cmd) == 0) {
+            cmd_changed_.push_back(it->item_);
+            queued = true;
         }
     }
-    return false;
+    wake(); // also for the conditions
+    return queued;
 }
 
 // handle condition schedules, parse string stored in schedule.time field
-void WebSchedulerService::condition() {
+// a condition is evaluated when an entity it reads has changed, on every poll if it also reads values
+// which don't report changes, on a sweep, and when it's new or its entities were bound again
+void WebSchedulerService::condition(const bool poll, const bool sweep) {
+    uint32_t changed[CHANGED_WORDS];
+    bool     has_changed = false;
+    for (uint8_t i = 0; i < CHANGED_WORDS; i++) {
+        changed[i] = changed_entities_[i].exchange(0, std::memory_order_relaxed);
+        has_changed |= changed[i] != 0;
+    }
+    if (!has_changed && !poll) {
+        return;
+    }
+
     for (ScheduleItem & scheduleItem : *scheduleItems_) {
         if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_CONDITION) {
-            auto match = compute(scheduleItem.time.c_str());
+            bool evaluate = sweep || (poll && scheduleItem.deps_polled);
+            if (scheduleItem.deps_version != EMSESP::entity_bindings_version()) {
+                scheduleItem.deps_polled  = !scheduleItem.time_expr.dependencies(scheduleItem.deps);
+                scheduleItem.deps_version = EMSESP::entity_bindings_version();
+                evaluate                  = true;
+            }
+            for (auto hash : scheduleItem.deps) {
+                evaluate |= (changed[(hash >> 5) % CHANGED_WORDS] & ((uint32_t)1 << (hash & 31))) != 0;
+            }
+            if (!evaluate) {
+                continue;
+            }
+
+            auto match = scheduleItem.time_expr.evaluate();
 #ifdef EMESESP_DEBUG
             // EMSESP::logger().debug("condition match: %s", match.c_str());
 #endif
             if (match.length() == 1 && match[0] == '1' && scheduleItem.retry_cnt == 0xFF) {
-                scheduleItem.retry_cnt = command(scheduleItem.name, scheduleItem.cmd.c_str(), compute(scheduleItem.value.c_str())) ? 1 : 0xFF;
+                scheduleItem.retry_cnt = command(scheduleItem.name, scheduleItem.cmd.c_str(), scheduleItem.value_expr.evaluate()) ? 1 : 0xFF;
             } else if (match.length() == 1 && match[0] == '0' && scheduleItem.retry_cnt == 1) {
                 scheduleItem.retry_cnt = 0xFF;
             } else if (match.length() != 1) { // the match is not boolean
@@ -432,9 +584,9 @@ void WebSchedulerService::loop() {
     static uint32_t last_uptime_min = 0;
     static uint32_t last_uptime_sec = 0;
 
-    if (!raw_value.empty()) { // process a value from system/message command
-        computed_value = compute(raw_value);
-        raw_value.clear();
+    std::string message;
+    while (messages_.pop(message)) { // from the system/message command
+        System::send_message(compute(message));
     }
 
     // get list of scheduler events and exit if it's empty
@@ -442,32 +594,32 @@ void WebSchedulerService::loop() {
         return;
     }
 
-    // check if we have onChange events
+    // check if we have onChange events and immediate schedules
     while (!cmd_changed_.empty()) {
-        ScheduleItem si = *cmd_changed_.front();
-        command(si.name, si.cmd.c_str(), compute(si.value.c_str()));
+        ScheduleItem & si = *cmd_changed_.front();
         cmd_changed_.pop_front();
-    }
-
-    for (ScheduleItem & scheduleItem : *scheduleItems_) {
-        if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_IMMEDIATE) {
-            command(scheduleItem.name, scheduleItem.cmd.c_str(), compute(scheduleItem.value.c_str()));
-            scheduleItem.active = false;
+        if (si.flags == SCHEDULEFLAG_SCHEDULE_IMMEDIATE) {
+            if (!si.active) {
+                continue; // deactivated while queued
+            }
+            si.active = false;
         }
+        command(si.name, si.cmd.c_str(), si.value_expr.evaluate());
     }
 
-    // check conditions every 10 seconds, start after one minute
+    // check conditions on changes, poll every 10 seconds and sweep all every minute, start after one minute
     uint32_t uptime_sec = uuid::get_uptime_sec() / 10;
-    if (last_uptime_sec != uptime_sec && uptime_sec > 5) {
-        condition();
+    if (uptime_sec > 5) {
+        bool poll = last_uptime_sec != uptime_sec;
+        condition(poll, poll && (uptime_sec % 6) == 0);
         last_uptime_sec = uptime_sec;
     }
 
     // check startup commands
     if (last_tm_min == -2) {
-        for (ScheduleItem & scheduleItem : *scheduleItems_) {
-            if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_TIMER && scheduleItem.elapsed_min == 0) {
-                scheduleItem.retry_cnt = command(scheduleItem.name, scheduleItem.cmd.c_str(), compute(scheduleItem.value.c_str())) ? 0xFF : 0;
+        for (ScheduleItem * scheduleItem : startup_) {
+            if (scheduleItem->active) {
+                scheduleItem->retry_cnt = command(scheduleItem->name, scheduleItem->cmd.c_str(), scheduleItem->value_expr.evaluate()) ? 0xFF : 0;
             }
         }
         last_tm_min = -1; // startup done, now use for RTC
@@ -476,17 +628,21 @@ void WebSchedulerService::loop() {
     // check timer every minute, sync to EMS-ESP clock
     uint32_t uptime_min = uuid::get_uptime_sec() / 60;
     if (last_uptime_min != uptime_min) {
-        for (ScheduleItem & scheduleItem : *scheduleItems_) {
-            // retry startup commands not yet executed
-            if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_TIMER && scheduleItem.elapsed_min == 0
-                && scheduleItem.retry_cnt < MAX_STARTUP_RETRIES) {
-                scheduleItem.retry_cnt = command(scheduleItem.name, scheduleItem.cmd.c_str(), scheduleItem.value.c_str()) ? 0xFF : scheduleItem.retry_cnt + 1;
+        // retry startup commands not yet executed
+        for (ScheduleItem * scheduleItem : startup_) {
+            if (scheduleItem->active && scheduleItem->retry_cnt < MAX_STARTUP_RETRIES) {
+                scheduleItem->retry_cnt = command(scheduleItem->name, scheduleItem->cmd.c_str(), scheduleItem->value.c_str()) ? 0xFF : scheduleItem->retry_cnt + 1;
             }
-            // scheduled timer commands
-            if (scheduleItem.active && scheduleItem.flags == SCHEDULEFLAG_SCHEDULE_TIMER && scheduleItem.elapsed_min > 0
-                && (uptime_min % scheduleItem.elapsed_min == 0)) {
-                command(scheduleItem.name, scheduleItem.cmd.c_str(), compute(scheduleItem.value.c_str()));
+        }
+        // scheduled timer commands, take all due and put them back with their next due minute
+        while (!timers_.empty() && timers_.front().due_min_ <= uptime_min) {
+            std::pop_heap(timers_.begin(), timers_.end(), timer_later);
+            TimerEntry & timer = timers_.back();
+            if (timer.item_->active && timer.due_min_ == uptime_min) {
+                command(timer.item_->name, timer.item_->cmd.c_str(), timer.item_->value_expr.evaluate());
             }
+            timer.due_min_ = (uptime_min / timer.item_->elapsed_min + 1) * timer.item_->elapsed_min;
+            std::push_heap(timers_.begin(), timers_.end(), timer_later);
         }
         last_uptime_min = uptime_min;
     }
@@ -495,14 +651,13 @@ void WebSchedulerService::loop() {
     time_t now = time(nullptr);
     tm *   tm  = localtime(&now);
     if (tm->tm_min != last_tm_min && tm->tm_year > 120) {
-        // find the real dow and minute from RTC
-        uint8_t  real_dow = 1 << tm->tm_wday; // 1 is Sunday
+        // find the real minute from RTC and the schedules of the day for it
         uint16_t real_min = tm->tm_hour * 60 + tm->tm_min;
-
-        for (const ScheduleItem & scheduleItem : *scheduleItems_) {
-            uint8_t dow = scheduleItem.flags & SCHEDULEFLAG_SCHEDULE_TIMER ? 0 : scheduleItem.flags;
-            if (scheduleItem.active && (real_dow & dow) && real_min == scheduleItem.elapsed_min) {
-                command(scheduleItem.name, scheduleItem.cmd.c_str(), compute(scheduleItem.value.c_str()));
+        auto &   day      = calendar_[tm->tm_wday]; // 0 is Sunday
+        auto     it = std::lower_bound(day.begin(), day.end(), real_min, [](const CalendarEntry & c, const uint16_t m) { return c.minute_ < m; });
+        for (; it != day.end() && it->minute_ == real_min; ++it) {
+            if (it->item_->active) {
+                command(it->item_->name, it->item_->cmd.c_str(), it->item_->value_expr.evaluate());
             }
         }
         last_tm_min = tm->tm_min;
@@ -510,11 +665,18 @@ void WebSchedulerService::loop() {
 }
 
 // process schedules async
+// sleeps until the next poll or minute, or until woken by a change or command
 void WebSchedulerService::scheduler_task(void * pvParameters) {
     while (1) {
-        delay(10); // no need to hurry
         if (EMSESP::system_.systemStatus() == SYSTEM_STATUS::SYSTEM_STATUS_NORMAL) {
             EMSESP::webSchedulerService.loop();
+#ifndef EMSESP_STANDALONE
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EMSESP::webSchedulerService.next_deadline_ms()));
+#else
+            delay(10);
+#endif
+        } else {
+            delay(10); // no need to hurry
         }
     }
 #ifndef EMSESP_STANDALONE
@@ -535,6 +697,7 @@ void WebSchedulerService::load_test_data() {
         si.time   = "12:00";
         si.cmd    = "system/fetch";
         si.value  = "10";
+        si.value_expr.compile(si.value.c_str());
         strcpy(si.name, "test_scheduler");
         si.elapsed_min = 0;
         si.retry_cnt   = 0xFF; // no startup retries
@@ -548,12 +711,14 @@ void WebSchedulerService::load_test_data() {
         si.time   = "13:00";
         si.cmd    = "system/message";
         si.value  = "20";
+        si.value_expr.compile(si.value.c_str());
         strcpy(si.name, ""); // to make sure its excluded from Dashboard
         si.elapsed_min = 0;
         si.retry_cnt   = 0xFF; // no startup retries
 
         webScheduler.scheduleItems.push_back(si);
 
+        build_index(webScheduler.scheduleItems);
         return StateUpdateResult::CHANGED; // persist the changes
     });
 }
@@ -18,6 +18,11 @@
 
 #include <esp32-psram.h>
 
+#include "../core/shuntingYard.h"
+#include "../core/ringbuffer.h"
+
+#include <atomic>
+
 #ifndef WebSchedulerService_h
 #define WebSchedulerService_h
 
@@ -61,6 +66,12 @@ class ScheduleItem {
     stringPSRAM value;
     char        name[20];
     uint8_t     retry_cnt;
+    Expression  time_expr;  // compiled condition, only for SCHEDULEFLAG_SCHEDULE_CONDITION
+    Expression  value_expr; // compiled value
+
+    std::vector<uint32_t> deps;         // hashes of the entities the condition reads, see Expression::dependencies()
+    uint32_t              deps_version; // EMSESP::entity_bindings_version() of deps
+    bool                  deps_polled;  // the condition also reads values which don't report changes
 };
 
 class WebScheduler {
@@ -87,9 +98,14 @@ class WebSchedulerService : public StatefulService<WebScheduler> {
     }
     uint8_t count_entities(bool cmd_only = false);
     bool    onChange(const char * cmd);
+    void    build_index(std::list<ScheduleItem, AllocatorPSRAM<ScheduleItem>> & scheduleItems);
+    void    wake();
+    bool    message(const char * value);
 
-    std::string raw_value;
-    std::string computed_value;
+    // check before building the entity path for onChange()
+    bool watches(const uint8_t device_type) const {
+        return watched_devices_.load(std::memory_order_relaxed) & ((uint32_t)1 << device_type);
+    }
 
 #if defined(EMSESP_TEST)
     void load_test_data();
@@ -101,8 +117,9 @@ class WebSchedulerService : public StatefulService<WebScheduler> {
 #endif
     static void scheduler_task(void * pvParameters);
 
-    bool command(const char * name, const std::string & cmd, const std::string & data);
-    void condition();
+    bool     command(const char * name, const std::string & cmd, const std::string & data);
+    void     condition(const bool poll, const bool sweep);
+    uint32_t next_deadline_ms() const;
 
     HttpEndpoint<WebScheduler>  _httpEndpoint;
     FSPersistence<WebScheduler> _fsPersistence;
@@ -110,6 +127,46 @@ class WebSchedulerService : public StatefulService<WebScheduler> {
 
     std::list<ScheduleItem, AllocatorPSRAM<ScheduleItem>> *   scheduleItems_; // pointer to the list of schedule events
     std::list<ScheduleItem *, AllocatorPSRAM<ScheduleItem *>> cmd_changed_;   // pointer to commands in list that are triggered by change
+
+    // onChange schedules by the entities in their time field
+    struct OnChangeIndex {
+        uint32_t       hash_; // Helpers::hash_lower() of path_
+        std::string    path_; // lower case, like "thermostat/hc1/seltemp"
+        ScheduleItem * item_;
+    };
+    std::vector<OnChangeIndex, AllocatorPSRAM<OnChangeIndex>> onchange_index_;     // sorted by hash_, in list order for the same hash
+    std::atomic<uint32_t>                                     watched_devices_{0}; // bit per device type read by onChange schedules or conditions
+
+    // timers with an interval by the uptime minute they are due next, a min-heap, see timer_later()
+    struct TimerEntry {
+        uint32_t       due_min_;
+        uint16_t       order_; // position in the list, timers due in the same minute run in list order
+        ScheduleItem * item_;
+    };
+    static bool timer_later(const TimerEntry & a, const TimerEntry & b) {
+        return a.due_min_ > b.due_min_ || (a.due_min_ == b.due_min_ && a.order_ > b.order_);
+    }
+    std::vector<TimerEntry, AllocatorPSRAM<TimerEntry>>         timers_;
+    std::vector<ScheduleItem *, AllocatorPSRAM<ScheduleItem *>> startup_; // timers at 00:00, run once at startup
+
+    // weekly schedules per day (0 is Sunday), sorted by minute of the day and in list order
+    struct CalendarEntry {
+        uint16_t       minute_;
+        ScheduleItem * item_;
+    };
+    std::vector<CalendarEntry, AllocatorPSRAM<CalendarEntry>> calendar_[7];
+
+#ifndef EMSESP_STANDALONE
+    TaskHandle_t task_handle_ = nullptr;
+#endif
+
+    // entities changed since the last check of the conditions, as bits of their hash
+    // set from any task in onChange(), a collision only causes an extra evaluation
+    static constexpr uint8_t CHANGED_WORDS = 8;
+    std::atomic<uint32_t>    changed_entities_[CHANGED_WORDS]{};
+
+    // system/message texts with a json/url block, computed in this task, see System::command_message()
+    MpscRingBuffer<std::string, 4> messages_;
 };
 
 } // namespace emsesp
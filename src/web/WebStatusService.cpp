@@ -38,6 +38,11 @@ WebStatusService::WebStatusService(AsyncWebServer * server, SecurityManager * se
         AuthenticationPredicates::IS_AUTHENTICATED,
         [this](AsyncWebServerRequest * request, JsonVariant json) { action(request, json); },
         HTTP_ANY);
+
+    // GET - the bus capture as text
+    securityManager->addEndpoint(server, EMSESP_CAPTURE_SERVICE_PATH, AuthenticationPredicates::IS_ADMIN, [this](AsyncWebServerRequest * request) {
+        capture(request);
+    });
 }
 
 // /rest/systemStatus
@@ -176,6 +181,21 @@ void WebStatusService::systemStatus(AsyncWebServerRequest * request) {
     request->send(response);
 }
 
+// /rest/capture
+// sends the bus capture in parts straight from its buffer, it can be up to 512 KB
+// what is recorded after the request is not included
+void WebStatusService::capture(AsyncWebServerRequest * request) {
+    size_t length = BusCapture::size();
+    if (!length) {
+        request->send(204); // no content
+        return;
+    }
+
+    request->send(request->beginResponse("text/plain", length, [length](uint8_t * buffer, size_t max_len, size_t index) -> size_t {
+        return index < length ? BusCapture::read(buffer, std::min(max_len, length - index), index) : 0;
+    }));
+}
+
 // generic action handler - as a POST
 void WebStatusService::action(AsyncWebServerRequest * request, JsonVariant json) {
     auto *     response = new AsyncJsonResponse();
@@ -3,6 +3,7 @@
 
 #define EMSESP_SYSTEM_STATUS_SERVICE_PATH "/rest/systemStatus"
 #define EMSESP_ACTION_SERVICE_PATH "/rest/action"
+#define EMSESP_CAPTURE_SERVICE_PATH "/rest/capture"
 
 #include <semver200.h> // for version checking
 #include "../emsesp_version.h"
@@ -25,6 +26,7 @@ class WebStatusService {
 #endif
     void systemStatus(AsyncWebServerRequest * request);
     void action(AsyncWebServerRequest * request, JsonVariant json);
+    void capture(AsyncWebServerRequest * request);
 
   private:
     SecurityManager * _securityManager;
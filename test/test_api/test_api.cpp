@@ -25,6 +25,17 @@
 #include "ESPAsyncWebServer.h"
 #include "web/WebAPIService.h"
 #include "test_shuntingYard.h"
+#include "test_ringbuffer.h"
+#include "test_commandqueue.h"
+#include "test_telegrampool.h"
+#include "test_txqueue.h"
+#include "test_fetch.h"
+#include "test_histogram.h"
+#include "test_capture.h"
+#include "test_publishqueue.h"
+#include "test_mqttdispatch.h"
+#include "test_customentity.h"
+#include "test_benchmark.h"
 
 using namespace emsesp;
 
@@ -532,6 +543,13 @@ int main() {
 
     add_devices(); // add devices
 
+    // the bus timings vary from run to run, start the tests with empty histograms
+    EMSbus::poll_to_send_.reset();
+    EMSbus::tx_to_reply_.reset();
+    EMSbus::write_to_ack_.reset();
+    EMSbus::tx_retries_.reset();
+    EMSbus::rx_queue_time_.reset();
+
 #if defined(EMSESP_UNITY_CREATE)
     create_tests();
     return 0;
@@ -546,6 +564,17 @@ int main() {
     run_manual_tests();       // execute some other manual tests from this file
     run_console_tests();      // execute some console tests
     run_shuntingYard_tests(); // execute the shuntingYard tests
+    run_customentity_tests(); // execute the custom entity tests
+    run_ringbuffer_tests();   // execute the Rx ring stress tests
+    run_commandqueue_tests(); // execute the command queue tests
+    run_telegrampool_tests(); // execute the telegram pool tests
+    run_txqueue_tests();      // execute the Tx queue tests
+    run_fetch_tests();        // execute the scheduled fetch tests
+    run_histogram_tests();    // execute the bus timing histogram tests
+    run_capture_tests();      // execute the bus capture tests
+    run_publishqueue_tests(); // execute the MQTT publish queue tests
+    run_mqttdispatch_tests(); // execute the incoming MQTT message tests
+    run_benchmark_tests();    // execute the micro-benchmarks
 
     return UNITY_END();
 }
@@ -0,0 +1,198 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <chrono>
+#include "core/telegram.h"
+#include "core/shuntingYard.h"
+
+// micro-benchmarks for the hot paths, the results are printed and only checked for sanity
+// timings on the host are only useful to compare changes, not as absolute numbers for the ESP32
+
+static constexpr uint32_t BENCHMARK_DECODE_TELEGRAMS  = 100000;
+static constexpr uint32_t BENCHMARK_PUBLISH_VALUES     = 100000;
+static constexpr uint32_t BENCHMARK_PUBLISH_DEVICES    = 2000;
+static constexpr uint32_t BENCHMARK_VALUE_INFO         = 100000;
+static constexpr uint32_t BENCHMARK_FIND_COMMAND       = 100000;
+static constexpr uint32_t BENCHMARK_EXPRESSIONS        = 20000;
+
+// run fn count times and return the average in ns
+template <typename F>
+static double benchmark_ns(uint32_t count, F fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        fn(i);
+        asm volatile("" ::: "memory"); // stop the compiler from hoisting pure lookups out of the loop
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+// add the CRC and feed a telegram to the Rx service
+static void benchmark_telegram(std::initializer_list<uint8_t> data) {
+    uint8_t telegram[EMS_MAX_TELEGRAM_LENGTH];
+    uint8_t length = 0;
+    for (const auto & d : data) {
+        telegram[length++] = d;
+    }
+    telegram[length] = emsesp::EMSbus::calculate_crc(telegram, length);
+    emsesp::EMSESP::rxservice_.add(telegram, length + 1);
+}
+
+// decode cost per telegram: CRC check, building the telegram, dispatch and the device handler
+void benchmark_decode() {
+    // Boiler -> All, UBAMonitorFast(0x18), about 20 values
+    uint8_t t1[] = {0x08, 0x00, 0x18, 0x00, 0x00, 0x02, 0x5A, 0x73, 0x3D, 0x0A, 0x10, 0x65, 0x40, 0x02, 0x1A,
+                    0x80, 0x00, 0x01, 0xE1, 0x01, 0x76, 0x0E, 0x3D, 0x48, 0x00, 0xC9, 0x44, 0x02, 0x00, 0x00};
+    // Thermostat -> All, HC1
+    uint8_t t2[] = {0x90, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0x03, 0x02, 0x00, 0xCD, 0x00, 0xE4, 0x00};
+
+    t1[sizeof(t1) - 1] = emsesp::EMSbus::calculate_crc(t1, sizeof(t1) - 1);
+    t2[sizeof(t2) - 1] = emsesp::EMSbus::calculate_crc(t2, sizeof(t2) - 1);
+
+    auto log_level = emsesp::EMSbus::logger_.level();
+    emsesp::EMSbus::logger_.level(uuid::log::Level::INFO);
+
+    uint32_t telegram_count = emsesp::EMSESP::rxservice_.telegram_count();
+
+    double boiler_ns = benchmark_ns(BENCHMARK_DECODE_TELEGRAMS, [&](uint32_t) {
+        emsesp::EMSESP::rxservice_.add(t1, sizeof(t1));
+        emsesp::EMSESP::rxservice_.loop();
+    });
+
+    double thermostat_ns = benchmark_ns(BENCHMARK_DECODE_TELEGRAMS, [&](uint32_t) {
+        emsesp::EMSESP::rxservice_.add(t2, sizeof(t2));
+        emsesp::EMSESP::rxservice_.loop();
+    });
+
+    emsesp::EMSbus::logger_.level(log_level);
+
+    char result[100];
+    snprintf(result, sizeof(result), "decode UBAMonitorFast: %.0f ns/telegram, thermostat HC1: %.0f ns/telegram", boiler_ns, thermostat_ns);
+    TEST_MESSAGE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(telegram_count + 2 * BENCHMARK_DECODE_TELEGRAMS, emsesp::EMSESP::rxservice_.telegram_count());
+}
+
+// change propagation for a single value, using the boiler entity registered last
+void benchmark_publish_value() {
+    emsesp::EMSdevice * boiler = nullptr;
+    for (const auto & emsdevice : emsesp::EMSESP::emsdevices) {
+        if (emsdevice->device_type() == emsesp::EMSdevice::DeviceType::BOILER) {
+            boiler = emsdevice.get();
+        }
+    }
+    TEST_ASSERT_NOT_NULL(boiler);
+    TEST_ASSERT_FALSE(boiler->devicevalues_.empty());
+
+    void * value_p = boiler->devicevalues_.back().value_p;
+
+    double publish_ns = benchmark_ns(BENCHMARK_PUBLISH_VALUES, [&](uint32_t) { boiler->publish_value(value_p); });
+
+    char result[100];
+    snprintf(result, sizeof(result), "publish_value (%d boiler entities): %.0f ns/value", (int)boiler->devicevalues_.size(), publish_ns);
+    TEST_MESSAGE(result);
+}
+
+// full MQTT publish of all thermostats, with an extra RC300 that has all 8 heating circuits populated
+void benchmark_publish_device_values() {
+    auto log_level = emsesp::EMSbus::logger_.level();
+    emsesp::EMSbus::logger_.level(uuid::log::Level::INFO);
+
+    benchmark_telegram({0x11, 0x0B, emsesp::EMSdevice::EMS_TYPE_VERSION, 0x00, 158, 0x01, 0x00}); // RC300 as thermostat 0x11
+    for (uint8_t hc = 0; hc < 8; hc++) {
+        // RC300Monitor(0x02A5 + hc)
+        benchmark_telegram({0x11, 0x00, 0xFF, 0x00, 0x01, (uint8_t)(0xA5 + hc), 0x80, 0x00, 0x01, 0x30, 0x28, 0x00, 0x30, 0x28, 0x01, 0x54,
+                            0x03, 0x03, 0x01, 0x01, 0x54, 0x02, 0xA8, 0x00, 0x00, 0x11, 0x01, 0x03, 0xFF, 0xFF, 0x00});
+        // RC300Set(0x02B9 + hc)
+        benchmark_telegram({0x11, 0x00, 0xFF, 0x00, 0x02, (uint8_t)(0xB9 + hc), 0x00, 0x2E, 0x22, 0x28, 0x26, 0x26, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00});
+    }
+
+    emsesp::EMSdevice * rc300 = nullptr;
+    for (const auto & emsdevice : emsesp::EMSESP::emsdevices) {
+        if (emsdevice->is_device_id(0x11)) {
+            rc300 = emsdevice.get();
+        }
+    }
+    TEST_ASSERT_NOT_NULL(rc300);
+    TEST_ASSERT_TRUE(rc300->has_tags(emsesp::DeviceValueTAG::TAG_HC8));
+
+    // MQTT is not connected here, so this measures building the payloads
+    double publish_ns = benchmark_ns(BENCHMARK_PUBLISH_DEVICES, [&](uint32_t) { emsesp::EMSESP::publish_device_values(emsesp::EMSdevice::DeviceType::THERMOSTAT); });
+
+    emsesp::EMSbus::logger_.level(log_level);
+
+    char result[100];
+    snprintf(result, sizeof(result), "publish_device_values(THERMOSTAT) with 8 hc (%d RC300 entities): %.0f us", (int)rc300->devicevalues_.size(), publish_ns / 1000);
+    TEST_MESSAGE(result);
+}
+
+// API lookup of a single entity, using the boiler entity registered last
+void benchmark_get_value_info() {
+    emsesp::EMSdevice * boiler = nullptr;
+    for (const auto & emsdevice : emsesp::EMSESP::emsdevices) {
+        if (emsdevice->device_type() == emsesp::EMSdevice::DeviceType::BOILER) {
+            boiler = emsdevice.get();
+        }
+    }
+    TEST_ASSERT_NOT_NULL(boiler);
+
+    std::string  cmd = emsesp::Helpers::toLower(boiler->devicevalues_.back().short_name);
+    JsonDocument doc;
+
+    double lookup_ns = benchmark_ns(BENCHMARK_VALUE_INFO, [&](uint32_t) {
+        doc.clear();
+        TEST_ASSERT_TRUE(boiler->get_value_info(doc.to<JsonObject>(), cmd.c_str(), -1));
+    });
+
+    char result[100];
+    snprintf(result, sizeof(result), "get_value_info(%s): %.0f ns/call", cmd.c_str(), lookup_ns);
+    TEST_MESSAGE(result);
+}
+
+// command lookup as done by every Command::call(), using the boiler command registered last
+void benchmark_find_command() {
+    const char * cmd = nullptr;
+    for (const auto & cf : emsesp::Command::commands()) {
+        if (cf.device_type_ == emsesp::EMSdevice::DeviceType::BOILER) {
+            cmd = cf.cmd_;
+        }
+    }
+    TEST_ASSERT_NOT_NULL(cmd);
+
+    double find_ns = benchmark_ns(BENCHMARK_FIND_COMMAND, [&](uint32_t) {
+        TEST_ASSERT_NOT_NULL(emsesp::Command::find_command(emsesp::EMSdevice::DeviceType::BOILER, 0, cmd, emsesp::CommandFlag::CMD_FLAG_DEFAULT));
+    });
+
+    char result[100];
+    snprintf(result, sizeof(result), "find_command(%s) with %d commands: %.0f ns/call", cmd, (int)emsesp::Command::commands().size(), find_ns);
+    TEST_MESSAGE(result);
+}
+
+// scheduler condition, interpreted by compute() against the compiled Expression, with and without an entity
+void benchmark_expression() {
+    const std::string calc = "(14 - 40) * 2.8 + 5 > 10";
+    const std::string cond = "(boiler/flowtempoffset - 20) * 2.8 + 5 > 50";
+
+    emsesp::Expression calc_expr(calc);
+    emsesp::Expression cond_expr(cond);
+    TEST_ASSERT_FALSE(calc_expr.interpreted());
+    TEST_ASSERT_EQUAL_STRING("0", calc_expr.evaluate().c_str());
+    TEST_ASSERT_EQUAL_STRING("1", cond_expr.evaluate().c_str());
+
+    double calc_compute_ns = benchmark_ns(BENCHMARK_EXPRESSIONS, [&](uint32_t) { TEST_ASSERT_FALSE(emsesp::compute(calc).empty()); });
+    double calc_eval_ns    = benchmark_ns(BENCHMARK_EXPRESSIONS, [&](uint32_t) { TEST_ASSERT_FALSE(calc_expr.evaluate().empty()); });
+    double cond_compute_ns = benchmark_ns(BENCHMARK_EXPRESSIONS, [&](uint32_t) { TEST_ASSERT_FALSE(emsesp::compute(cond).empty()); });
+    double cond_eval_ns    = benchmark_ns(BENCHMARK_EXPRESSIONS, [&](uint32_t) { TEST_ASSERT_FALSE(cond_expr.evaluate().empty()); });
+
+    char result[120];
+    snprintf(result, sizeof(result), "expression compute/evaluate: %.0f/%.0f ns, with entity: %.0f/%.0f ns", calc_compute_ns, calc_eval_ns, cond_compute_ns, cond_eval_ns);
+    TEST_MESSAGE(result);
+}
+
+void run_benchmark_tests() {
+    RUN_TEST(benchmark_decode);
+    RUN_TEST(benchmark_publish_value);
+    RUN_TEST(benchmark_publish_device_values);
+    RUN_TEST(benchmark_get_value_info);
+    RUN_TEST(benchmark_find_command);
+    RUN_TEST(benchmark_expression);
+}
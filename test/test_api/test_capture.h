@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <sstream>
+#include "core/buscapture.h"
+
+// tests for the bus capture, which is replayed with 'test replay'
+
+// every recorded frame reads back the same from the capture text
+void capture_test1() {
+    uint8_t poll[]     = {0x8B};
+    uint8_t telegram[] = {0x08, 0x0B, 0x14, 0x00, 0x3C, 0x1F, 0xAC, 0x70, 0x00};
+
+    emsesp::BusCapture::start();
+    TEST_ASSERT_TRUE(emsesp::BusCapture::active());
+    emsesp::BusCapture::record(poll, sizeof(poll));
+    emsesp::BusCapture::record(telegram, sizeof(telegram));
+    emsesp::BusCapture::record(poll, sizeof(poll));
+    emsesp::BusCapture::stop();
+    emsesp::BusCapture::record(poll, sizeof(poll)); // not recorded anymore
+
+    TEST_ASSERT_FALSE(emsesp::BusCapture::active());
+    TEST_ASSERT_EQUAL_UINT32(3, emsesp::BusCapture::frames());
+    TEST_ASSERT_EQUAL_UINT32(0, emsesp::BusCapture::dropped());
+
+    std::string text(emsesp::BusCapture::size(), '\0');
+    TEST_ASSERT_EQUAL_size_t(text.size(), emsesp::BusCapture::read((uint8_t *)&text[0], text.size() + 10, 0));
+    TEST_ASSERT_EQUAL_size_t(0, emsesp::BusCapture::read((uint8_t *)&text[0], 10, text.size()));
+
+    std::istringstream lines(text);
+    std::string        line;
+    uint8_t            data[EMS_MAX_TELEGRAM_LENGTH];
+    uint32_t           delta_us;
+
+    std::getline(lines, line);
+    TEST_ASSERT_EQUAL_UINT8(0, emsesp::BusCapture::parse(line.c_str(), delta_us, data)); // the header
+
+    std::getline(lines, line);
+    TEST_ASSERT_EQUAL_UINT8(1, emsesp::BusCapture::parse(line.c_str(), delta_us, data));
+    TEST_ASSERT_EQUAL_UINT32(0, delta_us);
+    TEST_ASSERT_EQUAL_UINT8(0x8B, data[0]);
+
+    std::getline(lines, line);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(telegram), emsesp::BusCapture::parse(line.c_str(), delta_us, data));
+    TEST_ASSERT_EQUAL_MEMORY(telegram, data, sizeof(telegram));
+
+    std::getline(lines, line);
+    TEST_ASSERT_EQUAL_UINT8(1, emsesp::BusCapture::parse(line.c_str(), delta_us, data));
+    TEST_ASSERT_FALSE(std::getline(lines, line));
+
+    emsesp::BusCapture::clear();
+    TEST_ASSERT_EQUAL_UINT32(0, emsesp::BusCapture::frames());
+}
+
+void run_capture_tests() {
+    RUN_TEST(capture_test1);
+}
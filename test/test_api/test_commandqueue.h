@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include "emsesp.h"
+
+// tests for commands from other tasks, they are queued and run by the main loop
+
+// a command posted from another task only runs when the main loop drains the queue
+void commandqueue_test1() {
+    std::atomic<bool> posted{false};
+    std::atomic<bool> done{false};
+    uint8_t           result = emsesp::CommandRet::FAIL;
+    std::string       value;
+
+    std::thread poster([&]() {
+        JsonDocument doc;
+        posted = emsesp::Command::post("api/boiler/flowtempoffset/value", true, doc.to<JsonObject>(), [&](const uint8_t return_code, JsonObject output) {
+            result = return_code;
+            value  = output["api_data"] | "";
+            done   = true;
+        });
+    });
+    poster.join();
+
+    TEST_ASSERT_TRUE(posted);
+    TEST_ASSERT_FALSE(done);
+    emsesp::Command::loop();
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL(emsesp::CommandRet::OK, result);
+    TEST_ASSERT_EQUAL_STRING("40", value.c_str());
+}
+
+// other work is posted the same way and runs in the order it was queued
+void commandqueue_test2() {
+    std::atomic<bool> posted{false};
+    std::string       order;
+
+    std::thread poster([&]() {
+        posted = emsesp::Command::post([&]() { order += "a"; }) && emsesp::Command::post([&]() { order += "b"; });
+    });
+    poster.join();
+
+    TEST_ASSERT_TRUE(posted);
+    TEST_ASSERT_EQUAL_STRING("", order.c_str());
+    emsesp::Command::loop();
+    TEST_ASSERT_EQUAL_STRING("ab", order.c_str());
+}
+
+// system/message is computed by the command itself in the main loop, unless it has a json/url block
+void commandqueue_test3() {
+    const char * messages[][2] = {{"hello", "hello"}, {"1+2", "3"}};
+    for (const auto & message : messages) {
+        JsonDocument input_doc;
+        JsonDocument output_doc;
+        input_doc["value"] = message[0];
+        JsonObject output  = output_doc.to<JsonObject>();
+        TEST_ASSERT_EQUAL(emsesp::CommandRet::OK, emsesp::Command::process("api/system/message", true, input_doc.as<JsonObject>(), output));
+        TEST_ASSERT_EQUAL_STRING(message[1], output["api_data"] | "");
+    }
+
+    // waiting for a http reply is left to the scheduler task
+    const char * url   = "{\"url\":\"http://localhost/msg\"}";
+    JsonDocument input_doc;
+    JsonDocument output_doc;
+    input_doc["value"] = url;
+    JsonObject output  = output_doc.to<JsonObject>();
+    TEST_ASSERT_EQUAL(emsesp::CommandRet::OK, emsesp::Command::process("api/system/message", true, input_doc.as<JsonObject>(), output));
+    TEST_ASSERT_FALSE(output["api_data"].is<const char *>());
+    std::string message;
+    TEST_ASSERT_TRUE(emsesp::EMSESP::webSchedulerService.messages_.pop(message));
+    TEST_ASSERT_EQUAL_STRING(url, message.c_str());
+}
+
+// the task that called EMSESP::start() is the main loop, any other is not
+void commandqueue_test4() {
+    std::atomic<bool> other{true};
+
+    std::thread caller([&]() { other = emsesp::Command::in_loop(); });
+    caller.join();
+
+    TEST_ASSERT_TRUE(emsesp::Command::in_loop());
+    TEST_ASSERT_FALSE(other);
+}
+
+// the web API from another task doesn't wait, the main loop sends the response when the command is done
+void commandqueue_test5() {
+    AsyncWebServerRequest request;
+    request.method(HTTP_GET);
+    request.url("/api/boiler/flowtempoffset/value");
+
+    std::thread caller([&]() { emsesp::EMSESP::webAPIService.webAPIService(&request); });
+    caller.join();
+
+    emsesp::Command::loop();
+    TEST_ASSERT_EQUAL_STRING("[{\"api_data\":\"40\"}]", emsesp::EMSESP::webAPIService.getResponse());
+}
+
+void run_commandqueue_tests() {
+    RUN_TEST(commandqueue_test1);
+    RUN_TEST(commandqueue_test2);
+    RUN_TEST(commandqueue_test3);
+    RUN_TEST(commandqueue_test4);
+    RUN_TEST(commandqueue_test5);
+}
@@ -0,0 +1,84 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "emsesp.h"
+
+// tests for reading custom entities from telegrams and fetching them
+
+// replace the custom entities, device 0x5F is not a known device so nothing is fetched by it
+static void customentity_load(const char * json) {
+    JsonDocument doc;
+    deserializeJson(doc, json);
+    emsesp::EMSESP::webCustomEntityService.update(doc.as<JsonObject>(), emsesp::WebCustomEntity::update);
+}
+
+static const char * customentity_entities = "{\"entities\":["
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":677,\"offset\":0,\"factor\":1,\"name\":\"ce_a\",\"value_type\":2},"
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":677,\"offset\":1,\"factor\":1,\"name\":\"ce_b\",\"value_type\":3},"
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":677,\"offset\":22,\"factor\":1,\"name\":\"ce_c\",\"value_type\":2},"
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":677,\"offset\":30,\"factor\":1,\"name\":\"ce_d\",\"value_type\":2},"
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":24,\"offset\":5,\"factor\":1,\"name\":\"ce_e\",\"value_type\":2},"
+                                            "{\"ram\":0,\"device_id\":95,\"type_id\":24,\"offset\":0,\"factor\":4,\"name\":\"ce_raw\",\"value_type\":9}"
+                                            "]}";
+
+// values are only taken from telegrams of their own device and type
+void customentity_test1() {
+    customentity_load(customentity_entities);
+    auto & service = emsesp::EMSESP::webCustomEntityService;
+
+    uint8_t data[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x08, 0x0B, 677, 0, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT8(EMS_VALUE_DEFAULT_UINT8, service.find_entity("ce_a")->value);
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 677, 0, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT32(0x11, service.find_entity("ce_a")->value);
+    TEST_ASSERT_EQUAL_UINT32(0x2233, service.find_entity("ce_b")->value);
+    TEST_ASSERT_EQUAL_UINT32(EMS_VALUE_DEFAULT_UINT8, service.find_entity("ce_e")->value);
+
+    // a raw string is set when its last part arrives, and again when a part with a changed byte completes it
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 24, 0, data, 2));
+    TEST_ASSERT_EQUAL_STRING("", service.find_entity("ce_raw")->data.c_str());
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 24, 2, data, 2));
+    TEST_ASSERT_EQUAL_STRING("11 22 11 22", service.find_entity("ce_raw")->data.c_str());
+
+    uint8_t same[] = {0x11, 0x22, 0x11, 0x22, 0x00, 0x66};
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 24, 0, same, sizeof(same)));
+    TEST_ASSERT_FALSE(service.find_entity("ce_raw")->raw_changed);
+    TEST_ASSERT_EQUAL_UINT32(0x66, service.find_entity("ce_e")->value);
+
+    uint8_t changed[] = {0x99};
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 24, 0, changed, sizeof(changed)));
+    TEST_ASSERT_TRUE(service.find_entity("ce_raw")->raw_changed);
+    TEST_ASSERT_EQUAL_STRING("11 22 11 22", service.find_entity("ce_raw")->data.c_str());
+    service.get_value(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x5F, 0x0B, 24, 1, &same[1], 3));
+    TEST_ASSERT_EQUAL_STRING("99 22 11 22", service.find_entity("ce_raw")->data.c_str());
+
+    emsesp::EMSESP::webCustomEntityService.load_test_data();
+}
+
+// entities in the same telegram are fetched with as few reads as fit in a telegram
+void customentity_test2() {
+    customentity_load(customentity_entities);
+    auto & queue  = emsesp::EMSESP::txservice_.queue();
+    size_t queued = queue.size();
+
+    emsesp::EMSESP::webCustomEntityService.fetch();
+
+    // offsets 0-5 of type 0x18 (string and value), 0-22 of 0x2A5 and 30 of 0x2A5 which doesn't fit
+    TEST_ASSERT_EQUAL_size_t(queued + 3, queue.size());
+    const uint16_t type_id[] = {24, 677, 677};
+    const uint8_t  offset[]  = {0, 0, 30};
+    const uint8_t  length[]  = {6, 23, 1};
+    for (uint8_t i = 0; i < 3; i++) {
+        auto & telegram = queue[queued + i].telegram_;
+        TEST_ASSERT_EQUAL_UINT8(0x5F, telegram->dest);
+        TEST_ASSERT_EQUAL_UINT16(type_id[i], telegram->type_id);
+        TEST_ASSERT_EQUAL_UINT8(offset[i], telegram->offset);
+        TEST_ASSERT_EQUAL_UINT8(length[i], telegram->message_data[0]);
+    }
+
+    emsesp::EMSESP::webCustomEntityService.load_test_data();
+}
+
+void run_customentity_tests() {
+    RUN_TEST(customentity_test1);
+    RUN_TEST(customentity_test2);
+}
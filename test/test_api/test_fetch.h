@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "emsesp.h"
+
+// tests for the scheduled fetch of the device telegrams
+
+// the scheduled fetch backs off for a telegram that doesn't change, and skips it when it was broadcasted
+void fetch_test1() {
+    emsesp::EMSdevice * boiler = nullptr;
+    for (const auto & emsdevice : emsesp::EMSESP::emsdevices) {
+        if (emsdevice->is_device_id(emsesp::EMSdevice::EMS_DEVICE_ID_BOILER)) {
+            boiler = emsdevice.get();
+            break;
+        }
+    }
+    TEST_ASSERT_NOT_NULL(boiler);
+
+    uint16_t index = 0;
+    while (index < boiler->telegram_functions_.size() && !boiler->telegram_functions_[index].fetch_) {
+        index++;
+    }
+    TEST_ASSERT_TRUE(index < boiler->telegram_functions_.size());
+    auto &   tf     = boiler->telegram_functions_[index];
+    uint8_t  data[] = {0x01, 0x02, 0x03};
+    uint16_t type   = tf.telegram_type_id_;
+
+    // replies to us with the same data
+    for (uint8_t i = 0; i < emsesp::EMSdevice::FETCH_MAX_BACKOFF + 2; i++) {
+        boiler->handle_telegram(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x08, 0x0B, type, 0, data, sizeof(data)), index);
+    }
+    TEST_ASSERT_EQUAL_UINT8(emsesp::EMSdevice::FETCH_MAX_BACKOFF, tf.fetch_backoff_);
+    TEST_ASSERT_EQUAL_UINT32(0, tf.broadcast_time_);
+
+    tf.fetch_skipped_ = 0;
+    for (uint8_t i = 1; i < (1 << emsesp::EMSdevice::FETCH_MAX_BACKOFF); i++) {
+        boiler->fetch_values(true);
+        TEST_ASSERT_EQUAL_UINT8(i, tf.fetch_skipped_);
+    }
+    boiler->fetch_values(true);
+    TEST_ASSERT_EQUAL_UINT8(0, tf.fetch_skipped_);
+
+    // a change brings it back to every cycle
+    data[1] = 0x22;
+    boiler->handle_telegram(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x08, 0x0B, type, 0, data, sizeof(data)), index);
+    TEST_ASSERT_EQUAL_UINT8(0, tf.fetch_backoff_);
+    boiler->fetch_values(true);
+    TEST_ASSERT_EQUAL_UINT8(0, tf.fetch_skipped_);
+
+    // seen on the bus, so not fetched and not counted
+    tf.fetch_skipped_ = 0;
+    boiler->handle_telegram(emsesp::Telegram(emsesp::Telegram::Operation::RX, 0x08, 0x00, type, 0, data, sizeof(data)), index);
+    TEST_ASSERT_EQUAL_UINT8(1, tf.fetch_backoff_);
+    boiler->fetch_values(true);
+    TEST_ASSERT_EQUAL_UINT8(0, tf.fetch_skipped_);
+
+    tf.fetch_backoff_  = 0;
+    tf.broadcast_time_ = 0;
+}
+
+void run_fetch_tests() {
+    RUN_TEST(fetch_test1);
+}
@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "core/histogram.h"
+#include "emsesp.h"
+
+// tests for the bus timing histograms
+
+// values go in the first bucket whose bound they don't exceed, the percentiles are the bucket bounds
+void histogram_test1() {
+    static constexpr uint32_t bounds[] = {10, 100, 1000};
+    emsesp::Histogram         histogram(bounds);
+
+    TEST_ASSERT_EQUAL_UINT8(4, histogram.buckets());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.percentile(50));
+
+    for (uint32_t value = 1; value <= 10; value++) {
+        histogram.add(value);
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+        histogram.add(50);
+    }
+    histogram.add(1000);
+    histogram.add(5000);
+
+    TEST_ASSERT_EQUAL_UINT32(20, histogram.count());
+    TEST_ASSERT_EQUAL_UINT32(10, histogram.count(0));
+    TEST_ASSERT_EQUAL_UINT32(8, histogram.count(1));
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.count(2));
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.count(3));
+    TEST_ASSERT_EQUAL_UINT32(5000, histogram.max());
+    TEST_ASSERT_EQUAL_UINT32(10, histogram.percentile(50));
+    TEST_ASSERT_EQUAL_UINT32(100, histogram.percentile(90));
+    TEST_ASSERT_EQUAL_UINT32(1000, histogram.percentile(95));
+    TEST_ASSERT_EQUAL_UINT32(5000, histogram.percentile(100)); // the overflow bucket reports the largest value
+
+    histogram.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.count());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.max());
+}
+
+// a write sent on a poll to us and acknowledged is counted in the bus timings
+void histogram_test2() {
+    using emsesp::EMSbus;
+    uint32_t polls   = EMSbus::poll_to_send_.count();
+    uint32_t replies = EMSbus::tx_to_reply_.count();
+    uint32_t acks    = EMSbus::write_to_ack_.count();
+    uint32_t first   = EMSbus::tx_retries_.count(0);
+
+    // send whatever the other tests left in the Tx queue, so ours is next
+    auto & txservice = emsesp::EMSESP::txservice_;
+    while (!txservice.tx_queue_empty()) {
+        txservice.send();
+    }
+    EMSbus::tx_state(emsesp::Telegram::Operation::NONE);
+
+    uint8_t value = 1;
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 0, &value, 1, 0, true);
+
+    uint8_t poll = EMSbus::ems_bus_id() ^ 0x80 ^ EMSbus::ems_mask();
+    emsesp::EMSESP::incoming_telegram(&poll, 1);
+    TEST_ASSERT_EQUAL_UINT8(emsesp::Telegram::Operation::TX_WRITE, EMSbus::tx_state());
+    TEST_ASSERT_EQUAL_UINT32(polls + 1, EMSbus::poll_to_send_.count());
+
+    uint8_t ack = emsesp::TxService::TX_WRITE_SUCCESS;
+    emsesp::EMSESP::incoming_telegram(&ack, 1);
+    TEST_ASSERT_EQUAL_UINT8(emsesp::Telegram::Operation::NONE, EMSbus::tx_state());
+    TEST_ASSERT_EQUAL_UINT32(replies + 1, EMSbus::tx_to_reply_.count());
+    TEST_ASSERT_EQUAL_UINT32(acks + 1, EMSbus::write_to_ack_.count());
+    TEST_ASSERT_EQUAL_UINT32(first + 1, EMSbus::tx_retries_.count(0));
+}
+
+void run_histogram_tests() {
+    RUN_TEST(histogram_test1);
+    RUN_TEST(histogram_test2);
+}
@@ -0,0 +1,94 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <thread>
+#include "emsesp.h"
+
+// tests for incoming MQTT messages, the subscribed topics and the fast path for plain values
+
+// a plain value takes the fast path and ends the same as through the json input
+void mqttdispatch_test1() {
+    const char * paths[][2] = {{"thermostat/hc1/seltemp", "21"},
+                               {"thermostat/seltemp", "20.5"},
+                               {"thermostat/hc2.seltemp", "19"},
+                               {"boiler/flowtempoffset", "41"},
+                               {"boiler/flowtempoffset", "abc"},
+                               {"boiler/nosuchcommand", "1"}};
+
+    for (const auto & path : paths) {
+        JsonDocument fast_doc;
+        JsonObject   fast_output = fast_doc.to<JsonObject>();
+        uint8_t      fast_code   = emsesp::CommandRet::FAIL;
+        TEST_ASSERT_TRUE(emsesp::Command::process_value(path[0], path[1], true, fast_output, fast_code));
+
+        JsonDocument input_doc;
+        JsonDocument output_doc;
+        input_doc["value"] = path[1];
+        JsonObject output  = output_doc.to<JsonObject>();
+        uint8_t    code    = emsesp::Command::process(path[0], true, input_doc.as<JsonObject>(), output);
+
+        TEST_ASSERT_EQUAL_UINT8(code, fast_code);
+        TEST_ASSERT_EQUAL_STRING(output["message"] | "", fast_output["message"] | "");
+    }
+}
+
+// anything that is not a plain value to a command of a known device is left to Command::process()
+void mqttdispatch_test2() {
+    const char * paths[][2] = {{"thermostat", "21"},
+                               {"thermostat/hc1/", "21"},
+                               {"/seltemp", "21"},
+                               {"nodevice/seltemp", "21"},
+                               {"thermostat/hc1/seltemp/value", "21"},
+                               {"thermostat/hc1/seltemp", "{\"value\":21}"},
+                               {"thermostat/hc1/seltemp", "boiler/flowtempoffset"}};
+
+    for (const auto & path : paths) {
+        JsonDocument doc;
+        uint8_t      code = emsesp::CommandRet::FAIL;
+        TEST_ASSERT_FALSE(emsesp::Command::process_value(path[0], path[1], true, doc.to<JsonObject>(), code));
+    }
+}
+
+// subscribed topics are found from the full topic, also after the index is rebuilt with the settings
+void mqttdispatch_test3() {
+    static uint8_t received = 0;
+    emsesp::Mqtt::subscribe(emsesp::EMSdevice::DeviceType::SYSTEM, "dispatchtest", [](const char *) {
+        received++;
+        return true;
+    });
+
+    std::string topic = emsesp::Mqtt::base() + "/dispatchtest";
+    emsesp::Mqtt::on_message(topic.c_str(), (const uint8_t *)"1", 1);
+    TEST_ASSERT_EQUAL_UINT8(1, received);
+    emsesp::Mqtt::on_message("other/dispatchtest", (const uint8_t *)"1", 1);
+    TEST_ASSERT_EQUAL_UINT8(1, received);
+
+    emsesp::Mqtt::load_settings();
+    emsesp::Mqtt::on_message(topic.c_str(), (const uint8_t *)"1", 1);
+    TEST_ASSERT_EQUAL_UINT8(2, received);
+}
+
+// a plain value from the MQTT task takes the fast path in the main loop, the write is queued only there
+void mqttdispatch_test4() {
+    auto written = []() {
+        const auto & queue = emsesp::EMSESP::txservice_.queue();
+        return std::any_of(queue.cbegin(), queue.cend(), [](const emsesp::TxService::QueuedTxTelegram & tx) {
+            return tx.telegram_->operation == emsesp::Telegram::Operation::TX_WRITE && tx.telegram_->message_data[0] == 43;
+        });
+    };
+    std::string topic = emsesp::Mqtt::base() + "/boiler/flowtempoffset";
+
+    std::thread mqtt_task([&]() { emsesp::Mqtt::on_message(topic.c_str(), (const uint8_t *)"43", 2); });
+    mqtt_task.join();
+    TEST_ASSERT_FALSE(written());
+
+    emsesp::Command::loop();
+    TEST_ASSERT_TRUE(written());
+}
+
+void run_mqttdispatch_tests() {
+    RUN_TEST(mqttdispatch_test1);
+    RUN_TEST(mqttdispatch_test2);
+    RUN_TEST(mqttdispatch_test3);
+    RUN_TEST(mqttdispatch_test4);
+}
@@ -0,0 +1,200 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <thread>
+#include "core/publishqueue.h"
+#include "Packets/Packet.h"
+#include "emsesp.h"
+
+// tests for the MQTT publishes waiting to be handed to the MQTT client
+
+// a newer payload replaces the waiting one and keeps its place
+void publishqueue_test1() {
+    emsesp::PublishQueue queue(3);
+
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.1", false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/flamecurr", "1.2", false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.2", false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.3", true));
+    TEST_ASSERT_EQUAL_size_t(2, queue.size());
+    TEST_ASSERT_EQUAL_UINT32(2, queue.coalesced());
+
+    // full for a new topic, but a waiting topic can still be replaced
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/seltemp", "55", false));
+    TEST_ASSERT_FALSE(queue.push("ems-esp/boiler_data/heatingon", "on", false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/flamecurr", "1.3", false));
+
+    emsesp::PublishQueue::Message message;
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("ems-esp/boiler_data/curflowtemp", message.topic_.c_str());
+    TEST_ASSERT_EQUAL_STRING("40.3", message.payload_.c_str());
+    TEST_ASSERT_TRUE(message.retain_);
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("1.3", message.payload_.c_str());
+
+    // sent topics are new again
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.4", false));
+    TEST_ASSERT_EQUAL_UINT32(3, queue.coalesced());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("ems-esp/boiler_data/seltemp", message.topic_.c_str());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("40.4", message.payload_.c_str());
+    TEST_ASSERT_FALSE(queue.pop(message));
+    TEST_ASSERT_TRUE(queue.empty());
+}
+
+// the MQTT task publishes while the main loop flushes, each topic ends with its last value
+void publishqueue_test2() {
+    static constexpr uint32_t TOPICS  = 10;
+    static constexpr uint32_t CHANGES = 20000;
+    emsesp::PublishQueue      queue(TOPICS);
+    std::atomic<bool>         done{false};
+
+    std::thread producer([&]() {
+        char topic[20];
+        char payload[12];
+        for (uint32_t i = 0; i < CHANGES; i++) {
+            snprintf(topic, sizeof(topic), "topic%u", (unsigned)(i % TOPICS));
+            snprintf(payload, sizeof(payload), "%u", (unsigned)i);
+            queue.push(topic, payload, false);
+        }
+        done = true;
+    });
+
+    uint32_t                      last[TOPICS] = {};
+    uint32_t                      popped       = 0;
+    uint32_t                      older        = 0;
+    emsesp::PublishQueue::Message message;
+    auto                          drain = [&]() {
+        while (queue.pop(message)) {
+            uint32_t t     = atoi(message.topic_.c_str() + 5);
+            uint32_t value = atoi(message.payload_.c_str());
+            if (value < last[t]) {
+                older++;
+            }
+            last[t] = value;
+            popped++;
+        }
+    };
+    while (!done) {
+        drain();
+    }
+    producer.join();
+    drain();
+
+    TEST_ASSERT_EQUAL_UINT32(0, older);
+    for (uint32_t t = 0; t < TOPICS; t++) {
+        TEST_ASSERT_EQUAL_UINT32(CHANGES - TOPICS + t, last[t]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(CHANGES, popped + queue.coalesced());
+}
+
+// json is serialized straight into the pending publish and into the MQTT packet, the same as from a copy
+void publishqueue_test3() {
+    JsonDocument doc;
+    doc["seltemp"] = 21.5;
+    doc["mode"]    = "auto";
+    std::string text;
+    serializeJson(doc, text);
+    auto writer = [&doc](uint8_t * data, size_t length) { return serializeJson(doc, data, length); };
+
+    emsesp::PublishQueue queue(2);
+    TEST_ASSERT_TRUE(queue.push("ems-esp/thermostat_data", "{}", false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/thermostat_data", measureJson(doc), writer, true));
+    emsesp::PublishQueue::Message message;
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING(text.c_str(), message.payload_.c_str());
+
+    espMqttClientTypes::Error      error_copy, error_writer;
+    espMqttClientInternals::Packet copy(error_copy, 1, "ems-esp/thermostat_data", (const uint8_t *)text.data(), text.size(), 1, true);
+    espMqttClientInternals::Packet written(error_writer, 1, "ems-esp/thermostat_data", measureJson(doc), writer, 1, true);
+    TEST_ASSERT_TRUE(error_writer == espMqttClientTypes::Error::SUCCESS);
+    TEST_ASSERT_EQUAL_size_t(copy.size(), written.size());
+    TEST_ASSERT_EQUAL_MEMORY(copy.data(0), written.data(0), copy.size());
+
+    // a writer that doesn't fill the payload makes no packet
+    espMqttClientInternals::Packet short_packet(error_writer, 1, "ems-esp/thermostat_data", text.size() + 1, writer, 1, true);
+    TEST_ASSERT_TRUE(error_writer == espMqttClientTypes::Error::MALFORMED_PARAMETER);
+}
+
+// while disconnected the latest publish per topic is kept for the reconnect, HA configs are not
+void publishqueue_test4() {
+    TEST_ASSERT_FALSE(emsesp::Mqtt::connected());
+    uint32_t pending   = emsesp::Mqtt::publish_pending();
+    uint32_t coalesced = emsesp::Mqtt::publish_coalesced();
+
+    emsesp::Mqtt::queue_publish("backlog_test", "1");
+    emsesp::Mqtt::queue_publish("backlog_test", "2");
+    JsonDocument doc;
+    doc["name"] = "backlog";
+    emsesp::Mqtt::queue_ha("sensor/backlog_test/config", doc.as<JsonObject>());
+
+    TEST_ASSERT_EQUAL_UINT32(pending + 1, emsesp::Mqtt::publish_pending());
+    TEST_ASSERT_EQUAL_UINT32(coalesced + 1, emsesp::Mqtt::publish_coalesced());
+    TEST_ASSERT_EQUAL_UINT32(0, emsesp::Mqtt::publish_queued());
+}
+
+// the rate limit allows a burst of one second, then refills with the time, a large item may take it into debt
+void publishqueue_test5() {
+    emsesp::TokenBucket bucket;
+    TEST_ASSERT_TRUE(bucket.available()); // unlimited
+
+    bucket.rate(10);
+    bucket.refill(1000);
+    for (uint8_t i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(bucket.available());
+        bucket.take(1);
+    }
+    TEST_ASSERT_FALSE(bucket.available());
+
+    bucket.refill(1000);
+    TEST_ASSERT_FALSE(bucket.available());
+    bucket.refill(1050); // half a token is enough for the next one
+    TEST_ASSERT_TRUE(bucket.available());
+    bucket.take(25);
+    bucket.refill(2050);
+    TEST_ASSERT_FALSE(bucket.available());
+    bucket.refill(60000); // never more than a second's worth
+    TEST_ASSERT_FALSE(bucket.available());
+    bucket.refill(61000);
+    TEST_ASSERT_TRUE(bucket.available());
+}
+
+// without add only a waiting topic is replaced, for the offline backlog limit of all priorities together
+void publishqueue_test6() {
+    emsesp::PublishQueue queue(2);
+    TEST_ASSERT_EQUAL_size_t(2, queue.room());
+
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.1", false));
+    TEST_ASSERT_FALSE(queue.push("ems-esp/boiler_data/flamecurr", "1.2", false, false));
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/curflowtemp", "40.2", false, false));
+    TEST_ASSERT_EQUAL_size_t(1, queue.room());
+
+    TEST_ASSERT_TRUE(queue.push("ems-esp/boiler_data/flamecurr", "1.2", false));
+    TEST_ASSERT_EQUAL_size_t(0, queue.room());
+}
+
+// the bytes waiting follow the replaced payloads, which limits the offline backlog without PSRAM
+void publishqueue_test7() {
+    emsesp::PublishQueue queue(2);
+    TEST_ASSERT_TRUE(queue.push("topic1", "1234", false));
+    TEST_ASSERT_TRUE(queue.push("topic2", "1", false));
+    TEST_ASSERT_EQUAL_size_t(6 + 4 + 6 + 1, queue.bytes());
+    TEST_ASSERT_TRUE(queue.push("topic1", "12", false));
+    TEST_ASSERT_EQUAL_size_t(6 + 2 + 6 + 1, queue.bytes());
+
+    emsesp::PublishQueue::Message message;
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_size_t(6 + 1, queue.bytes());
+    queue.clear();
+    TEST_ASSERT_EQUAL_size_t(0, queue.bytes());
+}
+
+void run_publishqueue_tests() {
+    RUN_TEST(publishqueue_test1);
+    RUN_TEST(publishqueue_test2);
+    RUN_TEST(publishqueue_test3);
+    RUN_TEST(publishqueue_test4);
+    RUN_TEST(publishqueue_test5);
+    RUN_TEST(publishqueue_test6);
+    RUN_TEST(publishqueue_test7);
+}
@@ -0,0 +1,186 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <thread>
+#include "core/ringbuffer.h"
+#include "core/telegram.h"
+
+// stress tests for the lock-free Rx ring between the UART task and the main loop
+// the producer and consumer run on separate threads and hammer the ring concurrently
+
+static constexpr uint32_t RINGBUFFER_TEST_FRAMES = 200000;
+
+using TestRxFrame = emsesp::RxService::RxFrame;
+
+// fill a frame with a pattern derived from its sequence number
+static void ringbuffer_fill(TestRxFrame & frame, uint32_t seq) {
+    frame.timestamp_ = seq;
+    frame.length_    = 1 + (seq % EMS_MAX_TELEGRAM_LENGTH);
+    for (uint8_t i = 0; i < frame.length_; i++) {
+        frame.data_[i] = (uint8_t)(seq + i * 7);
+    }
+}
+
+static bool ringbuffer_check(const TestRxFrame & frame, uint32_t seq) {
+    if (frame.timestamp_ != seq || frame.length_ != 1 + (seq % EMS_MAX_TELEGRAM_LENGTH)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < frame.length_; i++) {
+        if (frame.data_[i] != (uint8_t)(seq + i * 7)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// producer spins when the ring is full, so every frame must arrive intact and in order
+void ringbuffer_test1() {
+    static emsesp::RingBuffer<TestRxFrame, MAX_RX_FRAMES> ring;
+
+    std::thread producer([&]() {
+        for (uint32_t seq = 0; seq < RINGBUFFER_TEST_FRAMES; seq++) {
+            TestRxFrame * slot;
+            while ((slot = ring.write_slot()) == nullptr) {
+                std::this_thread::yield();
+            }
+            ringbuffer_fill(*slot, seq);
+            ring.push();
+        }
+    });
+
+    uint32_t received  = 0;
+    uint32_t corrupted = 0;
+    while (received < RINGBUFFER_TEST_FRAMES) {
+        const TestRxFrame * frame = ring.front();
+        if (frame == nullptr) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (!ringbuffer_check(*frame, received)) {
+            corrupted++;
+        }
+        TEST_ASSERT_TRUE(ring.size() <= ring.capacity());
+        ring.pop();
+        received++;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, corrupted);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+// producer never waits (like the UART task), frames are dropped when full
+// whatever arrives must be intact, strictly increasing, and received + dropped must add up
+void ringbuffer_test2() {
+    static emsesp::RingBuffer<TestRxFrame, MAX_RX_FRAMES> ring;
+    std::atomic<uint32_t>                                 dropped{0};
+    std::atomic<bool>                                     done{false};
+
+    std::thread producer([&]() {
+        for (uint32_t seq = 0; seq < RINGBUFFER_TEST_FRAMES; seq++) {
+            TestRxFrame * slot = ring.write_slot();
+            if (slot == nullptr) {
+                dropped++;
+                continue;
+            }
+            ringbuffer_fill(*slot, seq);
+            ring.push();
+        }
+        done = true;
+    });
+
+    uint32_t received  = 0;
+    uint32_t corrupted = 0;
+    int64_t  last_seq  = -1;
+    while (!done || !ring.empty()) {
+        const TestRxFrame * frame = ring.front();
+        if (frame == nullptr) {
+            continue;
+        }
+        uint32_t seq = frame->timestamp_;
+        if ((int64_t)seq <= last_seq || !ringbuffer_check(*frame, seq)) {
+            corrupted++;
+        }
+        last_seq = seq;
+        ring.pop();
+        received++;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, corrupted);
+    TEST_ASSERT_EQUAL_UINT32(RINGBUFFER_TEST_FRAMES, received + dropped);
+}
+
+// UART task pushes raw frames into the RxService while the main loop drains it
+void ringbuffer_test3() {
+    static emsesp::RxService rxservice;
+    // Boiler -> Me, UBAuptime(0x14)
+    uint8_t                  frame[] = {0x08, 0x0B, 0x14, 0x00, 0x3C, 0x1F, 0xAC, 0x70, 0x00};
+    frame[sizeof(frame) - 1]         = emsesp::EMSbus::calculate_crc(frame, sizeof(frame) - 1);
+
+    std::atomic<bool> done{false};
+    std::thread       producer([&]() {
+        for (uint32_t i = 0; i < RINGBUFFER_TEST_FRAMES / 10; i++) {
+            rxservice.push(frame, sizeof(frame));
+        }
+        done = true;
+    });
+
+    while (!done) {
+        rxservice.loop();
+    }
+    producer.join();
+    rxservice.loop();
+
+    TEST_ASSERT_EQUAL_UINT32(0, rxservice.frames_pending());
+    TEST_ASSERT_EQUAL_UINT32(0, rxservice.telegram_error_count());
+    TEST_ASSERT_EQUAL_UINT32(RINGBUFFER_TEST_FRAMES / 10, rxservice.telegram_count() + rxservice.frame_overflow_count());
+}
+
+// several producers push concurrently, each producer's items must arrive once and in order
+void ringbuffer_test4() {
+    static constexpr uint32_t PRODUCERS = 4;
+    static emsesp::MpscRingBuffer<uint32_t, 16> ring;
+
+    std::thread producers[PRODUCERS];
+    for (uint32_t p = 0; p < PRODUCERS; p++) {
+        producers[p] = std::thread([p]() {
+            for (uint32_t seq = 0; seq < RINGBUFFER_TEST_FRAMES / PRODUCERS; seq++) {
+                uint32_t item = (p << 24) | seq;
+                while (!ring.push(std::move(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint32_t next[PRODUCERS] = {};
+    uint32_t received        = 0;
+    uint32_t corrupted       = 0;
+    while (received < RINGBUFFER_TEST_FRAMES) {
+        uint32_t item;
+        if (!ring.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t p = item >> 24;
+        if (p >= PRODUCERS || (item & 0xFFFFFF) != next[p]) {
+            corrupted++;
+        } else {
+            next[p]++;
+        }
+        received++;
+    }
+    for (auto & producer : producers) {
+        producer.join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, corrupted);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void run_ringbuffer_tests() {
+    RUN_TEST(ringbuffer_test1);
+    RUN_TEST(ringbuffer_test2);
+    RUN_TEST(ringbuffer_test3);
+    RUN_TEST(ringbuffer_test4);
+}
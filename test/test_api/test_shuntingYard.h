@@ -5,6 +5,8 @@
 
 void run_shuntingYard_test(const std::string & expected, const std::string & actual) {
     TEST_ASSERT_EQUAL_STRING(expected.c_str(), emsesp::compute(actual).c_str());
+    // the compiled expression must give the same result
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), emsesp::Expression(actual).evaluate().c_str());
 }
 
 void shuntingYard_test1() {
@@ -107,6 +109,33 @@ void shuntingYard_test25() {
     run_shuntingYard_test("hello world!", "'hello world!'");
 }
 
+// a compiled expression binds its references again after the custom entities are reloaded
+void shuntingYard_test26() {
+    emsesp::Expression expr("custom/test_seltemp + 1");
+    TEST_ASSERT_EQUAL_STRING("15", expr.evaluate().c_str());
+    emsesp::EMSESP::webCustomEntityService.load_test_data();
+    TEST_ASSERT_EQUAL_STRING("15", expr.evaluate().c_str());
+}
+
+// the entities a condition reads as onChange() reports them, flowtempoffset is in the dhw circuit
+void shuntingYard_test27() {
+    std::vector<uint32_t> hashes;
+    emsesp::Expression    expr("boiler/flowtempoffset > 30 && custom/test_seltemp < 20");
+    TEST_ASSERT_TRUE(expr.dependencies(hashes));
+    TEST_ASSERT_EQUAL_INT(2, hashes.size());
+    TEST_ASSERT_EQUAL_UINT32(emsesp::Helpers::hash_lower("boiler/dhw/flowtempoffset"), hashes[0]);
+    TEST_ASSERT_EQUAL_UINT32(emsesp::Helpers::hash_lower("custom/test_seltemp"), hashes[1]);
+
+    emsesp::Expression rssi("system/network/rssi < 0");
+    TEST_ASSERT_FALSE(rssi.dependencies(hashes));
+}
+
+// compute() and the compiled expression share the calculator, intermediates are not rounded
+void shuntingYard_test28() {
+    run_shuntingYard_test("1", "1/3*3");
+    run_shuntingYard_test("0.5", "0.0000001*5000000");
+}
+
 void run_shuntingYard_tests() {
     RUN_TEST(shuntingYard_test1);
     RUN_TEST(shuntingYard_test2);
@@ -133,4 +162,7 @@ void run_shuntingYard_tests() {
     RUN_TEST(shuntingYard_test23);
     RUN_TEST(shuntingYard_test24);
     RUN_TEST(shuntingYard_test25);
+    RUN_TEST(shuntingYard_test26);
+    RUN_TEST(shuntingYard_test27);
+    RUN_TEST(shuntingYard_test28);
 }
@@ -0,0 +1,94 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "core/telegram.h"
+#include "HeapStats.h"
+
+// tests for the Telegram pool used by the Rx and Tx services
+
+static constexpr uint32_t TELEGRAMPOOL_REPLAY_TELEGRAMS = 10000;
+
+// fill the pool, the next telegram must come from the heap and everything must be given back
+void telegrampool_test1() {
+    uint16_t in_use    = emsesp::TelegramPool::in_use();
+    uint32_t fallbacks = emsesp::TelegramPool::fallback_count();
+    uint8_t  data[]    = {0x01, 0x02, 0x03};
+
+    TEST_ASSERT_EQUAL_UINT16(MAX_POOLED_TELEGRAMS, emsesp::TelegramPool::size());
+
+    std::vector<emsesp::TelegramPtr> telegrams;
+    telegrams.reserve(MAX_POOLED_TELEGRAMS + 1);
+    for (uint16_t i = in_use; i < MAX_POOLED_TELEGRAMS; i++) {
+        telegrams.push_back(emsesp::TelegramPool::create(emsesp::Telegram::Operation::RX, 0x08, 0x00, i, 0, data, sizeof(data)));
+        TEST_ASSERT_EQUAL_UINT16(i, telegrams.back()->type_id);
+    }
+    TEST_ASSERT_EQUAL_UINT16(MAX_POOLED_TELEGRAMS, emsesp::TelegramPool::in_use());
+    TEST_ASSERT_EQUAL_UINT32(fallbacks, emsesp::TelegramPool::fallback_count());
+
+    telegrams.push_back(emsesp::TelegramPool::create(emsesp::Telegram::Operation::RX, 0x08, 0x00, 0x18, 0, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT32(fallbacks + 1, emsesp::TelegramPool::fallback_count());
+    TEST_ASSERT_EQUAL_UINT8(0x03, telegrams.back()->message_data[2]);
+
+    // moving a handle keeps the slot, destroying it gives the slot back
+    emsesp::TelegramPtr moved = std::move(telegrams.front());
+    TEST_ASSERT_FALSE(telegrams.front());
+    TEST_ASSERT_EQUAL_UINT16(MAX_POOLED_TELEGRAMS, emsesp::TelegramPool::in_use());
+    moved.reset();
+    TEST_ASSERT_EQUAL_UINT16(MAX_POOLED_TELEGRAMS - 1, emsesp::TelegramPool::in_use());
+
+    telegrams.clear();
+    TEST_ASSERT_EQUAL_UINT16(in_use, emsesp::TelegramPool::in_use());
+}
+
+// replay telegrams from the UART through the Rx queue to the devices, after a warm-up nothing may be allocated
+void telegrampool_test2() {
+    // Boiler -> All, UBAMonitorFast(0x18)
+    uint8_t t1[] = {0x08, 0x00, 0x18, 0x00, 0x00, 0x02, 0x5A, 0x73, 0x3D, 0x0A, 0x10, 0x65, 0x40, 0x02, 0x1A,
+                    0x80, 0x00, 0x01, 0xE1, 0x01, 0x76, 0x0E, 0x3D, 0x48, 0x00, 0xC9, 0x44, 0x02, 0x00, 0x00};
+    // Boiler -> Me, UBAuptime(0x14)
+    uint8_t t2[] = {0x08, 0x0B, 0x14, 0x00, 0x3C, 0x1F, 0xAC, 0x70, 0x00};
+    // Thermostat -> All, HC1
+    uint8_t t3[] = {0x90, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0x03, 0x02, 0x00, 0xCD, 0x00, 0xE4, 0x00};
+
+    t1[sizeof(t1) - 1] = emsesp::EMSbus::calculate_crc(t1, sizeof(t1) - 1);
+    t2[sizeof(t2) - 1] = emsesp::EMSbus::calculate_crc(t2, sizeof(t2) - 1);
+    t3[sizeof(t3) - 1] = emsesp::EMSbus::calculate_crc(t3, sizeof(t3) - 1);
+
+    auto replay = [&](uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            switch (i % 3) {
+            case 0:
+                emsesp::EMSESP::rxservice_.push(t1, sizeof(t1));
+                break;
+            case 1:
+                emsesp::EMSESP::rxservice_.push(t2, sizeof(t2));
+                break;
+            default:
+                emsesp::EMSESP::rxservice_.push(t3, sizeof(t3));
+                break;
+            }
+            emsesp::EMSESP::rxservice_.loop();
+        }
+    };
+
+    replay(3); // warm-up, the values are set the first time
+
+    uint32_t telegram_count = emsesp::EMSESP::rxservice_.telegram_count();
+    uint32_t fallbacks      = emsesp::TelegramPool::fallback_count();
+    uint32_t allocs         = heap_alloc_count();
+
+    // the debug log of every Rx telegram would allocate, so only measure the telegram path
+    auto log_level = emsesp::EMSbus::logger_.level();
+    emsesp::EMSbus::logger_.level(uuid::log::Level::INFO);
+    replay(TELEGRAMPOOL_REPLAY_TELEGRAMS);
+    emsesp::EMSbus::logger_.level(log_level);
+
+    TEST_ASSERT_EQUAL_UINT32(0, heap_alloc_count() - allocs);
+    TEST_ASSERT_EQUAL_UINT32(fallbacks, emsesp::TelegramPool::fallback_count());
+    TEST_ASSERT_EQUAL_UINT32(telegram_count + TELEGRAMPOOL_REPLAY_TELEGRAMS, emsesp::EMSESP::rxservice_.telegram_count());
+}
+
+void run_telegrampool_tests() {
+    RUN_TEST(telegrampool_test1);
+    RUN_TEST(telegrampool_test2);
+}
@@ -0,0 +1,67 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "core/telegram.h"
+
+// tests for the order of the Tx queue, and reads and writes waiting in it
+
+static bool txqueue_check(const emsesp::TxService & txservice, const std::vector<uint16_t> & type_ids) {
+    const auto & queue = txservice.queue();
+    if (queue.size() != type_ids.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < type_ids.size(); i++) {
+        if (queue[i].telegram_->type_id != type_ids[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// writes go before reads in front, which go before the fetches, each in the order they were added
+void txqueue_test1() {
+    static emsesp::TxService txservice;
+    uint8_t                  value = 1;
+
+    txservice.read_request(0x18, 0x08);
+    txservice.read_request(0xA2, 0x10);
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 0, &value, 1, 0, true);
+    txservice.read_request(0x19, 0x08, 0, 0, true);
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x10, 0x2B9, 2, &value, 1, 0, true);
+    TEST_ASSERT_TRUE(txqueue_check(txservice, {0x33, 0x2B9, 0x19, 0x18, 0xA2}));
+
+    // the same read again is dropped, unless it is more urgent
+    txservice.read_request(0xA2, 0x10);
+    txservice.read_request(0x19, 0x08);
+    TEST_ASSERT_TRUE(txqueue_check(txservice, {0x33, 0x2B9, 0x19, 0x18, 0xA2}));
+    txservice.read_request(0xA2, 0x10, 0, 0, true);
+    TEST_ASSERT_TRUE(txqueue_check(txservice, {0x33, 0x2B9, 0x19, 0xA2, 0x18}));
+
+    // another offset or length is a different read
+    txservice.read_request(0x18, 0x08, 1);
+    txservice.read_request(0x18, 0x08, 0, 5);
+    TEST_ASSERT_EQUAL_size_t(7, txservice.queue().size());
+}
+
+// a write to a value already waiting takes its place with the new data
+void txqueue_test2() {
+    static emsesp::TxService txservice;
+    uint8_t                  value = 1;
+
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 0, &value, 1, 0, true);
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x10, 0x2B9, 2, &value, 1, 0, true);
+    value = 2;
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 0, &value, 1, 0, true);
+    value = 3;
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 0, &value, 1, 0, true);
+    txservice.add(emsesp::Telegram::Operation::TX_WRITE, 0x08, 0x33, 1, &value, 1, 0, true);
+
+    TEST_ASSERT_TRUE(txqueue_check(txservice, {0x33, 0x2B9, 0x33}));
+    TEST_ASSERT_EQUAL_UINT8(3, txservice.queue()[0].telegram_->message_data[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, txservice.queue()[1].telegram_->message_data[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, txservice.queue()[2].telegram_->offset);
+}
+
+void run_txqueue_tests() {
+    RUN_TEST(txqueue_test1);
+    RUN_TEST(txqueue_test2);
+}